@@ -4,6 +4,8 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 namespace {
 
@@ -17,6 +19,106 @@ inline void cas2_increment(lscq::Entry* value, lscq::Entry& expected) {
   }
 }
 
+// ---------------------------------------------------------------------------------------------
+// Slot reads: "before" is the no-op CAS2 the queues used to read a slot; "after" are the
+// non-mutating loads selected by lscq::entry_load_mode().
+// ---------------------------------------------------------------------------------------------
+
+using SlotRead = lscq::Entry (*)(const lscq::Entry*);
+
+// Old read path: cas2(ptr, e, e). Goes through the stripe mutex when CAS2 is not native.
+lscq::Entry read_cas2_noop(const lscq::Entry* ptr) {
+  lscq::Entry expected{0u, 0u};
+  (void)lscq::cas2(const_cast<lscq::Entry*>(ptr), expected, expected);
+  return expected;
+}
+
+#if LSCQ_ARCH_X86_64 && (defined(__GNUC__) || defined(__clang__))
+// Old read path as it behaves on a native-CAS2 build: LOCK CMPXCHG16B takes the line exclusive.
+__attribute__((target("cx16"))) lscq::Entry read_cmpxchg16b(const lscq::Entry* ptr) {
+  __extension__ typedef unsigned __int128 u128;
+  auto* p = reinterpret_cast<u128*>(const_cast<lscq::Entry*>(ptr));
+  const u128 v = __sync_val_compare_and_swap(p, 0, 0);
+  lscq::Entry out;
+  std::memcpy(&out, &v, sizeof(out));
+  return out;
+}
+#endif
+
+lscq::Entry read_locked(const lscq::Entry* ptr) { return lscq::detail::entry_load_locked(ptr); }
+
+lscq::Entry read_two_word(const lscq::Entry* ptr) {
+  return lscq::detail::entry_load_two_word(ptr);
+}
+
+#if LSCQ_ARCH_X86_64
+lscq::Entry read_vector(const lscq::Entry* ptr) { return lscq::detail::entry_load_vector(ptr); }
+#endif
+
+lscq::Entry read_dispatch(const lscq::Entry* ptr) {
+  return lscq::detail::entry_load_dispatch(ptr);
+}
+
+// ---------------------------------------------------------------------------------------------
+// Slot writes: lscq::cas2 re-checks has_cas2_support() (and alignment) on every call; the queues
+// now resolve detail::Cas2Slots once and run a loop with the CAS inlined. Before the inline-asm
+// CMPXCHG16B, GCC builds without -mcx16 compiled only the mutex path (write_locked).
+// ---------------------------------------------------------------------------------------------
+
+using SlotCas = bool (*)(lscq::Entry*, lscq::Entry&, const lscq::Entry&);
+
+bool write_cas2(lscq::Entry* ptr, lscq::Entry& expected, const lscq::Entry& desired) {
+  return lscq::cas2(ptr, expected, desired);
+}
+
+bool write_locked(lscq::Entry* ptr, lscq::Entry& expected, const lscq::Entry& desired) {
+  return lscq::detail::Cas2Slots<lscq::EntryLoadMode::kLocked>::cas(ptr, expected, desired);
+}
+
+#if LSCQ_DETAIL_CAS2_NATIVE
+bool write_native(lscq::Entry* ptr, lscq::Entry& expected, const lscq::Entry& desired) {
+  return lscq::detail::cas2_native_slot(ptr, expected, desired);
+}
+#endif
+
+#if LSCQ_ARCH_X86_64 && (defined(__GNUC__) || defined(__clang__))
+// The compiler's own CMPXCHG16B (a per-function -mcx16), for comparison with the inline asm.
+__attribute__((target("cx16"))) bool write_sync_cx16(lscq::Entry* ptr, lscq::Entry& expected,
+                                                     const lscq::Entry& desired) {
+  __extension__ typedef unsigned __int128 u128;
+  u128 cmp;
+  u128 xchg;
+  std::memcpy(&cmp, &expected, sizeof(cmp));
+  std::memcpy(&xchg, &desired, sizeof(xchg));
+  const u128 seen = __sync_val_compare_and_swap(reinterpret_cast<u128*>(ptr), cmp, xchg);
+  std::memcpy(&expected, &seen, sizeof(seen));
+  return seen == cmp;
+}
+
+// Codegen check: the queues' CAS2 is a plain LOCK CMPXCHG16B with no call into libatomic or the
+// stripe mutex, and no -mcx16 on the command line:
+//   objdump -d -C --no-show-raw-insn benchmark_cas2 | grep -A12 '::cas2_codegen_probe(.*>:$'
+__attribute__((noinline)) bool cas2_codegen_probe(lscq::Entry* ptr, lscq::Entry& expected,
+                                                  const lscq::Entry& desired) {
+  return lscq::detail::Cas2Slots<lscq::EntryLoadMode::kTwoWord>::cas(ptr, expected, desired);
+}
+#endif
+
+bool native_cas2_usable(benchmark::State& state) {
+  if (!lscq::has_cas2_support()) {
+    state.SkipWithError("no native CAS2 on this CPU/build");
+    return false;
+  }
+  return true;
+}
+
+void set_load_counters(benchmark::State& state) {
+  state.counters["has_cas2_support"] =
+      benchmark::Counter(lscq::has_cas2_support() ? 1.0 : 0.0, benchmark::Counter::kAvgThreads);
+  state.counters["entry_load_mode"] = benchmark::Counter(
+      static_cast<double>(lscq::entry_load_mode()), benchmark::Counter::kAvgThreads);
+}
+
 }  // namespace
 
 static void bm_cas2_single_thread(benchmark::State& state) {
@@ -49,3 +151,104 @@ static void bm_cas2_contended(benchmark::State& state) {
 BENCHMARK(bm_cas2_contended)->Threads(2);
 BENCHMARK(bm_cas2_contended)->Threads(4);
 BENCHMARK(bm_cas2_contended)->Threads(8);
+
+template <SlotCas Cas, bool kNeedsNative>
+static void bm_slot_cas_single_thread(benchmark::State& state) {
+  if (kNeedsNative && !native_cas2_usable(state)) {
+    return;
+  }
+  lscq::Entry value{0u, 0u};
+  lscq::Entry expected{0u, 0u};
+  for (auto _ : state) {
+    const lscq::Entry desired{expected.cycle_flags + 1u, expected.index_or_ptr + 1u};
+    if (Cas(&value, expected, desired)) {
+      expected = desired;
+    }
+    benchmark::DoNotOptimize(expected);
+  }
+  state.counters["cas2_native_compiled"] = lscq::detail::kCas2NativeCompiled ? 1.0 : 0.0;
+  set_load_counters(state);
+}
+
+template <SlotCas Cas, bool kNeedsNative>
+static void bm_slot_cas_contended(benchmark::State& state) {
+  if (kNeedsNative && !native_cas2_usable(state)) {
+    return;
+  }
+  alignas(64) static lscq::Entry shared{0u, 0u};
+  lscq::Entry expected{0u, 0u};
+  for (auto _ : state) {
+    const lscq::Entry desired{expected.cycle_flags + 1u, expected.index_or_ptr + 1u};
+    if (Cas(&shared, expected, desired)) {
+      expected = desired;
+    }
+  }
+  benchmark::DoNotOptimize(expected);
+  state.counters["threads"] =
+      benchmark::Counter(static_cast<double>(state.threads()), benchmark::Counter::kAvgThreads);
+  set_load_counters(state);
+}
+
+#define LSCQ_BENCH_SLOT_CAS(fn, needs_native)                                      \
+  BENCHMARK_TEMPLATE(bm_slot_cas_single_thread, fn, needs_native);                 \
+  BENCHMARK_TEMPLATE(bm_slot_cas_contended, fn, needs_native)->Threads(2)->Threads(4)
+
+// Per-call dispatch, and the mutex path default GCC builds used to be limited to.
+LSCQ_BENCH_SLOT_CAS(write_cas2, false);
+LSCQ_BENCH_SLOT_CAS(write_locked, false);
+
+// Resolved once: the instruction inlined into the loop.
+#if LSCQ_DETAIL_CAS2_NATIVE
+LSCQ_BENCH_SLOT_CAS(write_native, true);
+#endif
+#if LSCQ_ARCH_X86_64 && (defined(__GNUC__) || defined(__clang__))
+LSCQ_BENCH_SLOT_CAS(write_sync_cx16, true);
+LSCQ_BENCH_SLOT_CAS(cas2_codegen_probe, true);
+#endif
+
+#undef LSCQ_BENCH_SLOT_CAS
+
+template <SlotRead Read>
+static void bm_entry_load_single_thread(benchmark::State& state) {
+  lscq::Entry value{1u, 2u};
+  for (auto _ : state) {
+    const lscq::Entry e = Read(&value);
+    // Consume the words the way the queues do, rather than spilling the 16-byte value.
+    benchmark::DoNotOptimize(e.cycle_flags ^ e.index_or_ptr);
+  }
+  set_load_counters(state);
+}
+
+// All threads read one shared slot, as queue readers do when polling the same head/tail entry.
+// With a CAS-based read every reader takes the line exclusive; the non-mutating loads share it.
+template <SlotRead Read>
+static void bm_entry_load_shared_readers(benchmark::State& state) {
+  alignas(64) static lscq::Entry shared{1u, 2u};
+  for (auto _ : state) {
+    const lscq::Entry e = Read(&shared);
+    benchmark::DoNotOptimize(e.cycle_flags ^ e.index_or_ptr);
+  }
+  state.counters["threads"] =
+      benchmark::Counter(static_cast<double>(state.threads()), benchmark::Counter::kAvgThreads);
+  set_load_counters(state);
+}
+
+#define LSCQ_BENCH_ENTRY_LOAD(fn)                                               \
+  BENCHMARK_TEMPLATE(bm_entry_load_single_thread, fn);                          \
+  BENCHMARK_TEMPLATE(bm_entry_load_shared_readers, fn)->Threads(2)->Threads(4)->Threads(8)
+
+// Before.
+LSCQ_BENCH_ENTRY_LOAD(read_cas2_noop);
+#if LSCQ_ARCH_X86_64 && (defined(__GNUC__) || defined(__clang__))
+LSCQ_BENCH_ENTRY_LOAD(read_cmpxchg16b);
+#endif
+
+// After.
+LSCQ_BENCH_ENTRY_LOAD(read_locked);
+LSCQ_BENCH_ENTRY_LOAD(read_two_word);
+#if LSCQ_ARCH_X86_64
+LSCQ_BENCH_ENTRY_LOAD(read_vector);
+#endif
+LSCQ_BENCH_ENTRY_LOAD(read_dispatch);
+
+#undef LSCQ_BENCH_ENTRY_LOAD
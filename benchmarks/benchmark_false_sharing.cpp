@@ -0,0 +1,107 @@
+// False sharing vs. padding unit (LSCQ_CACHE_LINE).
+//
+// The queues keep their contended counters (Head, Tail, threshold, LSCQ node links, EBR epoch,
+// pool guards) config::CACHE_LINE_SIZE bytes apart. These benchmarks reproduce that layout with
+// the padding as a template argument, so one binary shows what each choice costs on this machine:
+//
+// - BM_PerThreadCounter<Pad>: every thread increments its own counter, counters Pad bytes apart.
+//   With Pad = 8 all threads share one line; with Pad = 64 neighbours still share a 128-byte pair,
+//   which hurts on cores with 128-byte lines or an adjacent-line prefetcher.
+// - BM_HeadTail<Pad>: even threads bump "tail", odd threads bump "head", Pad bytes apart: the
+//   enqueuer/dequeuer split of SCQ's counters.
+//
+// The "lscq_cache_line" counter reports the padding the library itself was built with.
+
+#include <lscq/config.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+constexpr int kMaxThreads = 16;
+
+template <std::size_t Pad>
+struct alignas(Pad) PaddedCounter {
+    std::atomic<std::uint64_t> value{0};
+};
+
+template <std::size_t Pad>
+struct Counters {
+    PaddedCounter<Pad> slot[kMaxThreads];
+};
+
+template <std::size_t Pad>
+void add_padding_counters(benchmark::State& state) {
+    state.counters["pad_bytes"] = static_cast<double>(Pad);
+    state.counters["lscq_cache_line"] = static_cast<double>(lscq::config::CACHE_LINE_SIZE);
+}
+
+// Shared between the benchmark threads: thread 0 builds it before the timed loop and destroys it
+// after. Only the loop boundaries are barriers, so the other threads may touch it only inside the
+// loop.
+template <std::size_t Pad>
+std::unique_ptr<Counters<Pad>> g_counters;
+
+template <std::size_t Pad>
+void BM_PerThreadCounter(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_counters<Pad> = std::make_unique<Counters<Pad>>();
+    }
+
+    const int slot = state.thread_index();
+    for (auto _ : state) {
+        g_counters<Pad>->slot[slot].value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    if (state.thread_index() == 0) {
+        add_padding_counters<Pad>(state);
+        g_counters<Pad>.reset();
+    }
+}
+
+template <std::size_t Pad>
+void BM_HeadTail(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_counters<Pad> = std::make_unique<Counters<Pad>>();
+    }
+
+    // slot[0] and slot[1] are adjacent: Pad bytes apart, like head_ and tail_.
+    const int slot = state.thread_index() & 1;
+    for (auto _ : state) {
+        g_counters<Pad>->slot[slot].value.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+    if (state.thread_index() == 0) {
+        add_padding_counters<Pad>(state);
+        g_counters<Pad>.reset();
+    }
+}
+
+void apply_threads(benchmark::internal::Benchmark* b) {
+    b->ThreadRange(1, kMaxThreads);
+    b->UseRealTime();
+}
+
+void apply_pairs(benchmark::internal::Benchmark* b) {
+    b->DenseThreadRange(2, kMaxThreads, 2);
+    b->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PerThreadCounter, 8)->Apply(apply_threads);
+BENCHMARK_TEMPLATE(BM_PerThreadCounter, 64)->Apply(apply_threads);
+BENCHMARK_TEMPLATE(BM_PerThreadCounter, 128)->Apply(apply_threads);
+BENCHMARK_TEMPLATE(BM_PerThreadCounter, 256)->Apply(apply_threads);
+
+BENCHMARK_TEMPLATE(BM_HeadTail, 8)->Apply(apply_pairs);
+BENCHMARK_TEMPLATE(BM_HeadTail, 64)->Apply(apply_pairs);
+BENCHMARK_TEMPLATE(BM_HeadTail, 128)->Apply(apply_pairs);
+BENCHMARK_TEMPLATE(BM_HeadTail, 256)->Apply(apply_pairs);
@@ -0,0 +1,82 @@
+// Inlined vs. library-call queue hot paths.
+//
+// This file is compiled twice (see benchmarks/CMakeLists.txt):
+// - benchmark_inline_library links the pre-instantiated queues from lscq_impl, so every
+//   enqueue/dequeue below is an out-of-line call.
+// - benchmark_inline_header_only links lscq::header_only (LSCQ_HEADER_ONLY=1), so the compiler sees
+//   the definitions and can inline the fast path into the benchmark loop.
+// Benchmark names carry a /library or /header_only suffix so the two outputs can be merged.
+
+#include <lscq/config.hpp>
+#include <lscq/lscq.hpp>
+#include <lscq/msqueue.hpp>
+#include <lscq/ncq.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scq64.hpp>
+#include <lscq/scqp.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+#if LSCQ_HEADER_ONLY
+const std::string kMode = "/header_only";
+#else
+const std::string kMode = "/library";
+#endif
+
+constexpr std::size_t kRingSize = 1u << 12;
+constexpr std::uint64_t kValueMask = 1023;
+
+// One enqueue + one dequeue per iteration on an otherwise idle queue: the call overhead and
+// whatever the compiler can hoist out of the loop dominate.
+template <class Queue>
+void BM_IndexRoundTrip(benchmark::State& state) {
+    Queue q(kRingSize);
+    std::uint64_t v = 0;
+    for (auto _ : state) {
+        q.enqueue(v);
+        benchmark::DoNotOptimize(q.dequeue());
+        v = (v + 1) & kValueMask;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+}
+
+template <class Queue>
+void BM_PointerRoundTrip(benchmark::State& state) {
+    Queue q(kRingSize);
+    std::vector<std::uint64_t> values(kValueMask + 1);
+    std::uint64_t v = 0;
+    for (auto _ : state) {
+        q.enqueue(&values[v]);
+        benchmark::DoNotOptimize(q.dequeue());
+        v = (v + 1) & kValueMask;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+}
+
+void BM_MSQueueRoundTrip(benchmark::State& state) {
+    lscq::MSQueue<std::uint64_t> q;
+    std::uint64_t v = 0;
+    std::uint64_t out = 0;
+    for (auto _ : state) {
+        q.enqueue(v);
+        benchmark::DoNotOptimize(q.dequeue(out));
+        v = (v + 1) & kValueMask;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+}
+
+}  // namespace
+
+BENCHMARK(BM_IndexRoundTrip<lscq::NCQ<std::uint64_t>>)->Name("BM_NCQ_RoundTrip" + kMode);
+BENCHMARK(BM_IndexRoundTrip<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_RoundTrip" + kMode);
+BENCHMARK(BM_IndexRoundTrip<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_RoundTrip" + kMode);
+BENCHMARK(BM_PointerRoundTrip<lscq::SCQP<std::uint64_t>>)->Name("BM_SCQP_RoundTrip" + kMode);
+BENCHMARK(BM_PointerRoundTrip<lscq::LSCQ<std::uint64_t>>)->Name("BM_LSCQ_RoundTrip" + kMode);
+BENCHMARK(BM_MSQueueRoundTrip)->Name("BM_MSQueue_RoundTrip" + kMode);
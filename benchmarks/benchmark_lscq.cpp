@@ -1,10 +1,13 @@
 #include <lscq/ebr.hpp>
 #include <lscq/lscq.hpp>
+#include <lscq/pool_policy.hpp>
 #include <lscq/scqp.hpp>
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
@@ -17,6 +20,7 @@ namespace {
 
 constexpr std::size_t kOpsPerThread = 1'000'000;
 constexpr std::size_t kLSCQNodeSize = 1u << 12;  // 4K per node
+constexpr std::size_t kTurnoverNodesPerBurst = 8;
 
 class CyclicBarrier {
 public:
@@ -158,6 +162,169 @@ static void BM_LSCQ_Pair(benchmark::State& state) {
     }
 }
 
+// ============================================================================
+// Node Turnover Benchmarks
+// ============================================================================
+
+// Fill and drain bursts spanning several nodes, so every iteration links fresh nodes from the
+// pool and retires drained ones. With small nodes this is dominated by the per-node handoff
+// (SCQP::reset_for_reuse in prepare_node_for_use) rather than by the ring operations.
+static void BM_LSCQ_NodeTurnover(benchmark::State& state) {
+    using Value = std::uint64_t;
+
+    const std::size_t node_size = static_cast<std::size_t>(state.range(0));
+    const std::size_t burst = kTurnoverNodesPerBurst * node_size;
+
+    lscq::LSCQ<Value> queue(node_size);
+    std::vector<Value> values(burst);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < burst; ++i) {
+            queue.enqueue(&values[i]);
+        }
+        for (std::size_t i = 0; i < burst; ++i) {
+            benchmark::DoNotOptimize(queue.dequeue());
+        }
+    }
+
+    const std::uint64_t iterations = static_cast<std::uint64_t>(state.iterations());
+    state.SetItemsProcessed(static_cast<std::int64_t>(iterations * burst));
+    state.counters["node_scqsize"] = static_cast<double>(node_size);
+    state.counters["Mops"] = benchmark::Counter(
+        static_cast<double>(iterations * burst * 2) / 1e6, benchmark::Counter::kIsRate);
+}
+
+// ============================================================================
+// Tail Switch Latency Benchmarks
+// ============================================================================
+
+// Latency of the enqueue that finds the tail node full and links its successor, with the node
+// pool cleared before every burst so that each successor is a fresh allocation. Mode 0 allocates
+// in that enqueue (the default), mode 1 stages the successor at a 75% fill watermark, and mode 2
+// leaves staging to a helper thread calling stage_successor(). "other_max_ns" is the slowest of the
+// remaining enqueues: with the watermark, that is where the allocation moves to.
+static void BM_LSCQ_TailSwitchLatency(benchmark::State& state) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    using Clock = std::chrono::steady_clock;
+
+    const int mode = static_cast<int>(state.range(0));
+    const std::size_t node_size = static_cast<std::size_t>(state.range(1));
+    const std::size_t burst = kTurnoverNodesPerBurst * node_size;
+    lscq::LSCQNodeSizing sizing = lscq::LSCQNodeSizing::fixed(node_size);
+    if (mode == 1) {
+        sizing = sizing.with_staged_successor(75);
+    }
+    auto pool = std::make_shared<Queue::NodePool>(sizing);
+
+    std::vector<std::uint64_t> values(burst);
+    std::vector<double> switch_ns;
+    double other_max_ns = 0.0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto queue = std::make_unique<Queue>(pool);
+        std::atomic<bool> stop{false};
+        std::thread helper;
+        if (mode == 2) {
+            helper = std::thread([&] {
+                while (!stop.load(std::memory_order_acquire)) {
+                    queue->stage_successor();
+                    std::this_thread::yield();
+                }
+            });
+        }
+        state.ResumeTiming();
+
+        for (std::size_t i = 0; i < burst; ++i) {
+            const auto begin = Clock::now();
+            queue->enqueue(&values[i]);
+            const std::chrono::duration<double, std::nano> ns = Clock::now() - begin;
+            // A single producer fills each node exactly, so every node_size-th enqueue links.
+            if (i != 0 && i % node_size == 0) {
+                switch_ns.push_back(ns.count());
+            } else {
+                other_max_ns = std::max(other_max_ns, ns.count());
+            }
+        }
+
+        state.PauseTiming();
+        stop.store(true, std::memory_order_release);
+        if (helper.joinable()) {
+            helper.join();
+        }
+        queue.reset();
+        pool->Clear();
+        state.ResumeTiming();
+    }
+
+    std::sort(switch_ns.begin(), switch_ns.end());
+    const std::uint64_t iterations = static_cast<std::uint64_t>(state.iterations());
+    state.SetItemsProcessed(static_cast<std::int64_t>(iterations * burst));
+    state.counters["node_scqsize"] = static_cast<double>(node_size);
+    if (!switch_ns.empty()) {
+        state.counters["switch_p50_ns"] = switch_ns[switch_ns.size() / 2];
+        state.counters["switch_p99_ns"] = switch_ns[switch_ns.size() * 99 / 100];
+    }
+    state.counters["other_max_ns"] = other_max_ns;
+}
+
+// ============================================================================
+// Node Pool Policy Benchmarks
+// ============================================================================
+
+template <class PoolPolicy>
+using PooledLSCQ = lscq::LSCQ<std::uint64_t, lscq::DefaultWaitPolicy, PoolPolicy>;
+
+template <class PoolPolicy>
+std::shared_ptr<typename PooledLSCQ<PoolPolicy>::NodePool> g_node_pool;
+
+// One queue per benchmark thread, all drawing from one shared NodePool: each burst links
+// kTurnoverNodesPerBurst fresh nodes and retires as many, so every node handoff goes through the
+// pool policy's Get/Put. Nodes a thread retires are reused by its own next burst or, through the
+// shared storage, by the other threads' queues.
+template <class PoolPolicy>
+void BM_LSCQ_SharedPoolTurnover(benchmark::State& state) {
+    using Queue = PooledLSCQ<PoolPolicy>;
+    const std::size_t node_size = static_cast<std::size_t>(state.range(0));
+    const std::size_t burst = kTurnoverNodesPerBurst * node_size;
+    if (state.thread_index() == 0) {
+        g_node_pool<PoolPolicy> =
+            std::make_shared<typename Queue::NodePool>(lscq::LSCQNodeSizing::fixed(node_size));
+    }
+
+    std::unique_ptr<Queue> queue;
+    std::vector<std::uint64_t> values(burst);
+    for (auto _ : state) {
+        // Thread 0's pool is only guaranteed visible to the others once the timed loop runs.
+        if (!queue) {
+            queue = std::make_unique<Queue>(g_node_pool<PoolPolicy>);
+        }
+        for (std::size_t i = 0; i < burst; ++i) {
+            queue->enqueue(&values[i]);
+        }
+        for (std::size_t i = 0; i < burst; ++i) {
+            benchmark::DoNotOptimize(queue->dequeue());
+        }
+    }
+    queue.reset();
+
+    const std::uint64_t iterations = static_cast<std::uint64_t>(state.iterations());
+    state.SetItemsProcessed(static_cast<std::int64_t>(iterations * burst));
+    state.counters["node_scqsize"] =
+        benchmark::Counter(static_cast<double>(node_size), benchmark::Counter::kAvgThreads);
+    state.counters["Mops"] = benchmark::Counter(
+        static_cast<double>(iterations * burst * 2) / 1e6, benchmark::Counter::kIsRate);
+    if (state.thread_index() == 0) {
+        g_node_pool<PoolPolicy>.reset();
+    }
+}
+
+void apply_pool_policy_args(benchmark::internal::Benchmark* b) {
+    b->ArgName("node_scqsize");
+    b->Arg(64)->Arg(1024);
+    b->ThreadRange(1, 8);
+    b->UseRealTime();
+}
+
 // ============================================================================
 // SCQP Comparison Benchmarks
 // ============================================================================
@@ -265,6 +432,22 @@ BENCHMARK(BM_LSCQ_Pair)->Threads(4)->UseRealTime();
 BENCHMARK(BM_LSCQ_Pair)->Threads(8)->UseRealTime();
 BENCHMARK(BM_LSCQ_Pair)->Threads(16)->UseRealTime();
 
+BENCHMARK(BM_LSCQ_NodeTurnover)->RangeMultiplier(4)->Range(16, 1 << 16);
+
+BENCHMARK(BM_LSCQ_TailSwitchLatency)
+    ->ArgNames({"mode", "node_scqsize"})
+    ->ArgsProduct({{0, 1, 2}, {1024, 1 << 16}})
+    ->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_LSCQ_SharedPoolTurnover, lscq::ObjectPoolPolicy)
+    ->Apply(apply_pool_policy_args);
+BENCHMARK_TEMPLATE(BM_LSCQ_SharedPoolTurnover, lscq::ObjectPoolTLSPolicy)
+    ->Apply(apply_pool_policy_args);
+BENCHMARK_TEMPLATE(BM_LSCQ_SharedPoolTurnover, lscq::ObjectPoolTLSv2Policy<>)
+    ->Apply(apply_pool_policy_args);
+BENCHMARK_TEMPLATE(BM_LSCQ_SharedPoolTurnover, lscq::ObjectPoolMapPolicy)
+    ->Apply(apply_pool_policy_args);
+
 BENCHMARK(BM_SCQP_Pair_Comparison)->Threads(1)->UseRealTime();
 BENCHMARK(BM_SCQP_Pair_Comparison)->Threads(2)->UseRealTime();
 BENCHMARK(BM_SCQP_Pair_Comparison)->Threads(4)->UseRealTime();
@@ -9,7 +9,17 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <memory>
 #include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 namespace {
 
@@ -172,6 +182,106 @@ static void BM_MutexQueue_MemoryEfficiency(benchmark::State& state) {
     state.counters["estimated_mb"] = static_cast<double>(bytes) / (1024.0 * 1024.0);
 }
 
+struct ProcessMemory {
+    std::size_t virtual_bytes = 0;
+    std::size_t resident_bytes = 0;
+};
+
+// Current VSZ/RSS of this process; zeros where /proc/self/statm is not available.
+ProcessMemory read_process_memory() {
+    ProcessMemory mem;
+#if defined(__linux__)
+    if (std::FILE* f = std::fopen("/proc/self/statm", "r")) {
+        unsigned long size_pages = 0;
+        unsigned long resident_pages = 0;
+        if (std::fscanf(f, "%lu %lu", &size_pages, &resident_pages) == 2) {
+            const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            mem.virtual_bytes = size_pages * page;
+            mem.resident_bytes = resident_pages * page;
+        }
+        std::fclose(f);
+    }
+#endif
+    return mem;
+}
+
+enum LscqSizingMode : std::int64_t {
+    kFixedDefault = 0,  // LSCQ(): one DEFAULT_SCQSIZE node and a private pool
+    kGrowingPrivate,    // LSCQNodeSizing::growing(), private pool
+    kGrowingShared,     // LSCQNodeSizing::growing(), one NodePool shared by all queues
+};
+
+// Measured, not estimated: builds range(2) LSCQs in the given mode, puts range(1) items in
+// each and reports how much the process's RSS (and address space) grew per queue. The idle
+// case is the per-connection floor. A DEFAULT_SCQSIZE ring is an untouched anonymous mapping
+// until used, so the fixed layout mostly shows up as address space and as the pages the first
+// items land on (tickets are spread over the whole ring).
+static void BM_LSCQ_RSSPerQueue(benchmark::State& state) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    const auto mode = static_cast<LscqSizingMode>(state.range(0));
+    const std::size_t items = static_cast<std::size_t>(state.range(1));
+    const std::size_t queue_count = static_cast<std::size_t>(state.range(2));
+
+    std::vector<std::uint64_t> payload(items == 0 ? 1 : items);
+    double rss_per_queue = 0.0;
+    double vsz_per_queue = 0.0;
+    for (auto _ : state) {
+        std::shared_ptr<Queue::NodePool> shared_pool;
+        if (mode == kGrowingShared) {
+            shared_pool = std::make_shared<Queue::NodePool>(lscq::LSCQNodeSizing::growing());
+        }
+        std::vector<std::unique_ptr<Queue>> queues;
+        queues.reserve(queue_count);
+
+#if defined(__GLIBC__)
+        // Hand back the pages of chunks freed by earlier cases, so that reusing them counts.
+        malloc_trim(0);
+#endif
+        const ProcessMemory before = read_process_memory();
+        for (std::size_t q = 0; q < queue_count; ++q) {
+            switch (mode) {
+                case kFixedDefault:
+                    queues.push_back(std::make_unique<Queue>());
+                    break;
+                case kGrowingPrivate:
+                    queues.push_back(std::make_unique<Queue>(lscq::LSCQNodeSizing::growing()));
+                    break;
+                case kGrowingShared:
+                    queues.push_back(std::make_unique<Queue>(shared_pool));
+                    break;
+            }
+            for (std::size_t i = 0; i < items; ++i) {
+                queues.back()->enqueue(&payload[i]);
+            }
+        }
+        const ProcessMemory after = read_process_memory();
+
+        rss_per_queue = static_cast<double>(after.resident_bytes - before.resident_bytes) /
+                        static_cast<double>(queue_count);
+        vsz_per_queue = static_cast<double>(after.virtual_bytes - before.virtual_bytes) /
+                        static_cast<double>(queue_count);
+        benchmark::DoNotOptimize(queues.data());
+    }
+
+    state.counters["queues"] = static_cast<double>(queue_count);
+    state.counters["items_per_queue"] = static_cast<double>(items);
+    state.counters["queue_object_bytes"] = static_cast<double>(sizeof(Queue));
+    state.counters["rss_bytes_per_queue"] = rss_per_queue;
+    state.counters["vsz_bytes_per_queue"] = vsz_per_queue;
+}
+
+void apply_rss_per_queue_args(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"mode", "items", "queues"});
+    for (std::int64_t mode : {kFixedDefault, kGrowingPrivate, kGrowingShared}) {
+        for (std::int64_t items : {0, 10}) {
+            b->Args({mode, items, 4096});
+        }
+    }
+    b->Iterations(1);
+    b->UseRealTime();
+    b->Unit(benchmark::kMillisecond);
+}
+
 void apply_memory_args(benchmark::internal::Benchmark* b) {
     const std::size_t sizes[] = {1u << 10, 1u << 12, 1u << 14, 1u << 16, 1u << 18, 1u << 20, 1u << 22};
     for (std::size_t s : sizes) {
@@ -187,5 +297,6 @@ BENCHMARK(BM_NCQ_MemoryEfficiency)->Name("BM_NCQ_MemoryEfficiency")->Apply(apply
 BENCHMARK(BM_SCQ_MemoryEfficiency)->Name("BM_SCQ_MemoryEfficiency")->Apply(apply_memory_args);
 BENCHMARK(BM_SCQP_MemoryEfficiency)->Name("BM_SCQP_MemoryEfficiency")->Apply(apply_memory_args);
 BENCHMARK(BM_LSCQ_MemoryEfficiency)->Name("BM_LSCQ_MemoryEfficiency")->Apply(apply_memory_args);
+BENCHMARK(BM_LSCQ_RSSPerQueue)->Name("BM_LSCQ_RSSPerQueue")->Apply(apply_rss_per_queue_args);
 BENCHMARK(BM_MSQueue_MemoryEfficiency)->Name("BM_MSQueue_MemoryEfficiency")->Apply(apply_memory_args);
 BENCHMARK(BM_MutexQueue_MemoryEfficiency)->Name("BM_MutexQueue_MemoryEfficiency")->Apply(apply_memory_args);
@@ -70,18 +70,18 @@ static void BM_Mixed(benchmark::State& state) {
     state.counters["dequeue_pct"] =
         benchmark::Counter(static_cast<double>(100 - EnqueuePct), benchmark::Counter::kAvgThreads);
 
-    if constexpr (std::is_same_v<Queue, lscq::NCQ<lscq_bench::Value>>) {
+    if constexpr (lscq_bench::is_queue_family_v<Queue, lscq::NCQ>) {
         state.counters["capacity"] =
             benchmark::Counter(static_cast<double>(lscq_bench::kSharedCapacity),
                                benchmark::Counter::kAvgThreads);
-    } else if constexpr (std::is_same_v<Queue, lscq::SCQ<lscq_bench::Value>>) {
+    } else if constexpr (lscq_bench::is_queue_family_v<Queue, lscq::SCQ>) {
         state.counters["scqsize"] =
             benchmark::Counter(static_cast<double>(ctx->q->scqsize()), benchmark::Counter::kAvgThreads);
         state.counters["qsize"] =
             benchmark::Counter(static_cast<double>(ctx->q->qsize()), benchmark::Counter::kAvgThreads);
         state.counters["has_cas2_support"] =
             benchmark::Counter(lscq::has_cas2_support() ? 1.0 : 0.0, benchmark::Counter::kAvgThreads);
-    } else if constexpr (std::is_same_v<Queue, lscq::SCQP<lscq_bench::Value>>) {
+    } else if constexpr (lscq_bench::is_queue_family_v<Queue, lscq::SCQP>) {
         state.counters["scqsize"] =
             benchmark::Counter(static_cast<double>(ctx->q->scqsize()), benchmark::Counter::kAvgThreads);
         state.counters["qsize"] =
@@ -99,18 +99,19 @@ static void BM_Mixed(benchmark::State& state) {
     }
 }
 
-template <int EnqueuePct>
+template <int EnqueuePct, class WaitPolicy = lscq::DefaultWaitPolicy>
 static void BM_LSCQ_Mixed(benchmark::State& state) {
     lscq_bench::pin_thread_index(state.thread_index());
 
     static_assert(EnqueuePct >= 0 && EnqueuePct <= 100);
 
-    static std::atomic<lscq_bench::LSCQContext*> g_ctx{nullptr};
+    using ctx_t = lscq_bench::BasicLSCQContext<WaitPolicy>;
+    static std::atomic<ctx_t*> g_ctx{nullptr};
 
     const int threads = static_cast<int>(state.threads());
 
     if (state.thread_index() == 0) {
-        auto* ctx = new lscq_bench::LSCQContext(threads, lscq_bench::kLSCQNodeScqsize);
+        auto* ctx = new ctx_t(threads, lscq_bench::kLSCQNodeScqsize);
 
         const std::size_t prefill = static_cast<std::size_t>(threads) * 100u;
         for (std::size_t i = 0; i < prefill; ++i) {
@@ -121,7 +122,7 @@ static void BM_LSCQ_Mixed(benchmark::State& state) {
         g_ctx.store(ctx, std::memory_order_release);
     }
 
-    lscq_bench::LSCQContext* ctx = nullptr;
+    ctx_t* ctx = nullptr;
     while ((ctx = g_ctx.load(std::memory_order_acquire)) == nullptr) {
         std::this_thread::yield();
     }
@@ -182,6 +183,7 @@ BENCHMARK(BM_Mixed<lscq::NCQ<lscq_bench::Value>, 50>)->Name("BM_NCQ_50E50D")->Ap
 BENCHMARK(BM_Mixed<lscq::SCQ<lscq_bench::Value>, 50>)->Name("BM_SCQ_50E50D")->Apply(apply_threads);
 BENCHMARK(BM_Mixed<lscq::SCQP<lscq_bench::Value>, 50>)->Name("BM_SCQP_50E50D")->Apply(apply_threads);
 BENCHMARK(BM_LSCQ_Mixed<50>)->Name("BM_LSCQ_50E50D")->Apply(apply_threads);
+BENCHMARK(BM_Mixed<lscq::ShardedQueue<lscq::LSCQ<lscq_bench::Value>>, 50>)->Name("BM_ShardedLSCQ_50E50D")->Apply(apply_threads);
 BENCHMARK(BM_Mixed<lscq::MSQueue<lscq_bench::Value>, 50>)->Name("BM_MSQueue_50E50D")->Apply(apply_threads);
 BENCHMARK(BM_Mixed<lscq::MutexQueue<lscq_bench::Value>, 50>)->Name("BM_MutexQueue_50E50D")->Apply(apply_threads);
 
@@ -190,8 +192,19 @@ BENCHMARK(BM_Mixed<lscq::NCQ<lscq_bench::Value>, 30>)->Name("BM_NCQ_30E70D")->Ap
 BENCHMARK(BM_Mixed<lscq::SCQ<lscq_bench::Value>, 30>)->Name("BM_SCQ_30E70D")->Apply(apply_threads);
 BENCHMARK(BM_Mixed<lscq::SCQP<lscq_bench::Value>, 30>)->Name("BM_SCQP_30E70D")->Apply(apply_threads);
 BENCHMARK(BM_LSCQ_Mixed<30>)->Name("BM_LSCQ_30E70D")->Apply(apply_threads);
+BENCHMARK(BM_Mixed<lscq::ShardedQueue<lscq::LSCQ<lscq_bench::Value>>, 30>)->Name("BM_ShardedLSCQ_30E70D")->Apply(apply_threads);
 BENCHMARK(BM_Mixed<lscq::MSQueue<lscq_bench::Value>, 30>)->Name("BM_MSQueue_30E70D")->Apply(apply_threads);
 BENCHMARK(BM_Mixed<lscq::MutexQueue<lscq_bench::Value>, 30>)->Name("BM_MutexQueue_30E70D")->Apply(apply_threads);
 
+// 50E50D per wait policy (the unsuffixed runs above use lscq::DefaultWaitPolicy = BackoffWait)
+BENCHMARK(BM_Mixed<lscq::NCQ<lscq_bench::Value, lscq::BusySpinWait>, 50>)->Name("BM_NCQ_50E50D_BusySpin")->Apply(apply_threads);
+BENCHMARK(BM_Mixed<lscq::NCQ<lscq_bench::Value, lscq::SpinThenParkWait>, 50>)->Name("BM_NCQ_50E50D_SpinThenPark")->Apply(apply_threads);
+BENCHMARK(BM_Mixed<lscq::SCQ<lscq_bench::Value, lscq::BusySpinWait>, 50>)->Name("BM_SCQ_50E50D_BusySpin")->Apply(apply_threads);
+BENCHMARK(BM_Mixed<lscq::SCQ<lscq_bench::Value, lscq::SpinThenParkWait>, 50>)->Name("BM_SCQ_50E50D_SpinThenPark")->Apply(apply_threads);
+BENCHMARK(BM_Mixed<lscq::SCQP<lscq_bench::Value, lscq::BusySpinWait>, 50>)->Name("BM_SCQP_50E50D_BusySpin")->Apply(apply_threads);
+BENCHMARK(BM_Mixed<lscq::SCQP<lscq_bench::Value, lscq::SpinThenParkWait>, 50>)->Name("BM_SCQP_50E50D_SpinThenPark")->Apply(apply_threads);
+BENCHMARK(BM_LSCQ_Mixed<50, lscq::BusySpinWait>)->Name("BM_LSCQ_50E50D_BusySpin")->Apply(apply_threads);
+BENCHMARK(BM_LSCQ_Mixed<50, lscq::SpinThenParkWait>)->Name("BM_LSCQ_50E50D_SpinThenPark")->Apply(apply_threads);
+
 // 70E30D - Moved to benchmark_stress.cpp (independent stress test suite)
 // Only unbounded queues (MSQueue, LSCQ) are suitable for high enqueue pressure scenarios
@@ -90,6 +90,9 @@ static void BM_Pair(benchmark::State& state) {
             benchmark::Counter(ctx->q->is_using_fallback() ? 1.0 : 0.0, benchmark::Counter::kAvgThreads);
         state.counters["has_cas2_support"] =
             benchmark::Counter(lscq::has_cas2_support() ? 1.0 : 0.0, benchmark::Counter::kAvgThreads);
+    } else if constexpr (std::is_same_v<Queue, lscq::ShardedQueue<lscq::LSCQ<lscq_bench::Value>>>) {
+        state.counters["lanes"] =
+            benchmark::Counter(static_cast<double>(ctx->q->lane_count()), benchmark::Counter::kAvgThreads);
     }
 
     ctx->finish.arrive_and_wait();
@@ -99,6 +102,97 @@ static void BM_Pair(benchmark::State& state) {
     }
 }
 
+// Bulk pair: each iteration enqueues a batch of state.range(0) items with enqueue_bulk and then
+// dequeues the same number with dequeue_bulk, so Tail/Head are touched once per batch instead of
+// once per item.
+template <class Queue>
+static void BM_Pair_Bulk(benchmark::State& state) {
+    lscq_bench::pin_thread_index(state.thread_index());
+
+    using ops = lscq_bench::QueueOps<Queue>;
+    using ctx_t = lscq_bench::SharedContext<Queue>;
+    using item_t = typename ops::item_type;
+
+    static std::atomic<ctx_t*> g_ctx{nullptr};
+
+    const int threads = static_cast<int>(state.threads());
+    const std::size_t batch = static_cast<std::size_t>(state.range(0));
+
+    if (state.thread_index() == 0) {
+        auto* ctx = new ctx_t(threads, lscq_bench::kSharedCapacity);
+
+        const std::size_t prefill = static_cast<std::size_t>(threads) * 100u;
+        for (std::size_t i = 0; i < prefill; ++i) {
+            const item_t it = ctx->make_item(0, static_cast<std::uint64_t>(i));
+            (void)ops::enqueue(*ctx->q, it);
+        }
+
+        g_ctx.store(ctx, std::memory_order_release);
+    }
+
+    ctx_t* ctx = nullptr;
+    while ((ctx = g_ctx.load(std::memory_order_acquire)) == nullptr) {
+        std::this_thread::yield();
+    }
+
+    ctx->start.arrive_and_wait();
+
+    std::vector<item_t> in(batch);
+    std::vector<item_t> out(batch);
+    std::uint64_t seq = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < batch; ++i) {
+            in[i] = ctx->make_item(state.thread_index(), seq++);
+        }
+
+        std::size_t sent = 0;
+        int enq_retries = 0;
+        while (sent < batch) {
+            const std::size_t n = ops::enqueue_bulk(*ctx->q, in.data() + sent, batch - sent);
+            sent += n;
+            if (n == 0) {
+                if (++enq_retries > 100000) {
+                    state.SkipWithError("Bulk enqueue stuck - possible queue implementation issue");
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        std::size_t received = 0;
+        int deq_retries = 0;
+        while (received < batch) {
+            const std::size_t n =
+                ops::dequeue_bulk(*ctx->q, out.data() + received, batch - received);
+            received += n;
+            if (n == 0) {
+                if (++deq_retries > 100000) {
+                    state.SkipWithError("Bulk dequeue stuck - possible queue implementation issue");
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    ctx->finish.arrive_and_wait();
+
+    const std::uint64_t total_ops = static_cast<std::uint64_t>(state.iterations()) *
+                                    static_cast<std::uint64_t>(threads) * 2u *
+                                    static_cast<std::uint64_t>(batch);
+    lscq_bench::add_common_counters(state, threads, threads, total_ops);
+    state.counters["batch"] =
+        benchmark::Counter(static_cast<double>(batch), benchmark::Counter::kAvgThreads);
+
+    ctx->finish.arrive_and_wait();
+    if (state.thread_index() == 0) {
+        delete ctx;
+        g_ctx.store(nullptr, std::memory_order_release);
+    }
+}
+
 static void BM_LSCQ_Pair(benchmark::State& state) {
     lscq_bench::pin_thread_index(state.thread_index());
 
@@ -197,9 +291,23 @@ static void apply_threads(benchmark::internal::Benchmark* b) {
     b->UseRealTime();
 }
 
+static void apply_bulk_threads(benchmark::internal::Benchmark* b) {
+    // Args and Threads are crossed by the framework: batch in {4, 16, 64} x kThreadCounts.
+    b->ArgName("batch")->Arg(4)->Arg(16)->Arg(64);
+    for (int t : lscq_bench::kThreadCounts) {
+        b->Threads(t);
+    }
+    b->UseRealTime();
+}
+
 BENCHMARK(BM_Pair<lscq::NCQ<lscq_bench::Value>>)->Name("BM_NCQ_Pair")->Apply(apply_threads);
 BENCHMARK(BM_Pair<lscq::SCQ<lscq_bench::Value>>)->Name("BM_SCQ_Pair")->Apply(apply_threads);
 BENCHMARK(BM_Pair<lscq::SCQP<lscq_bench::Value>>)->Name("BM_SCQP_Pair")->Apply(apply_threads);
 BENCHMARK(BM_LSCQ_Pair)->Name("BM_LSCQ_Pair")->Apply(apply_threads);
+BENCHMARK(BM_Pair<lscq::ShardedQueue<lscq::LSCQ<lscq_bench::Value>>>)
+    ->Name("BM_ShardedLSCQ_Pair")
+    ->Apply(apply_threads);
 BENCHMARK(BM_Pair<lscq::MSQueue<lscq_bench::Value>>)->Name("BM_MSQueue_Pair")->Apply(apply_threads);
 BENCHMARK(BM_Pair<lscq::MutexQueue<lscq_bench::Value>>)->Name("BM_MutexQueue_Pair")->Apply(apply_threads);
+BENCHMARK(BM_Pair_Bulk<lscq::SCQ<lscq_bench::Value>>)->Name("BM_SCQ_Bulk")->Apply(apply_bulk_threads);
+BENCHMARK(BM_Pair_Bulk<lscq::SCQP<lscq_bench::Value>>)->Name("BM_SCQP_Bulk")->Apply(apply_bulk_threads);
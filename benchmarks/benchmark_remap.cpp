@@ -0,0 +1,177 @@
+// Slot remap policy sweep (cache_remap.hpp) across thread counts.
+//
+// Every policy runs the same shared-queue workload on SCQ and SCQP: a short backlog keeps Head and
+// Tail within a few lines of each other, so neighbouring tickets are in flight on different
+// threads at the same time, and each iteration does one enqueue + one dequeue (the *_Pair rows) or
+// one enqueue_bulk + one dequeue_bulk of kBatch items (the *_Bulk rows).
+//
+// - IdentityRemap: slots in ticket order; concurrent tickets share 64-byte lines.
+// - DefaultRemap (64 B): four consecutive tickets on four lines.
+// - AdjacentLineRemap (128 B): eight consecutive tickets on eight 128-byte line pairs, which is
+//   what matters when the L2 adjacent-line prefetcher pulls lines in pairs.
+// - StrideRemap<16>: a custom stride, to see where spreading stops paying for itself.
+//
+// The target is built header-only so that the custom stride needs no explicit instantiation.
+
+#include <lscq/cache_remap.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scqp.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kRing = std::size_t{1} << 12;
+// Items kept queued before the timed loop: enough that dequeues do not hit an empty ring.
+constexpr std::size_t kBacklog = 64;
+constexpr std::size_t kBatch = 16;
+// Values stay below SCQ's bottom marker (scqsize - 1).
+constexpr std::uint64_t kValueMask = 1023;
+
+using CustomStride = lscq::StrideRemap<16>;
+
+template <class Remap>
+using ScqOf = lscq::SCQ<std::uint64_t, lscq::DefaultWaitPolicy, Remap>;
+template <class Remap>
+using ScqpOf = lscq::SCQP<std::uint64_t, lscq::DefaultWaitPolicy, Remap>;
+
+// Shared between the benchmark threads: thread 0 builds it before the timed loop and destroys it
+// after. Only the loop boundaries are barriers, so the other threads may touch it only inside the
+// loop.
+template <class Queue>
+std::unique_ptr<Queue> g_queue;
+
+std::vector<std::uint64_t> g_values(kValueMask + 1);
+
+template <class Queue>
+void add_remap_counters(benchmark::State& state) {
+    state.counters["remap_stride"] = static_cast<double>(Queue::kRemapStride);
+    state.counters["ring_entries"] = static_cast<double>(g_queue<Queue>->scqsize());
+}
+
+template <class Remap>
+void BM_SCQ_Pair(benchmark::State& state) {
+    using Queue = ScqOf<Remap>;
+    if (state.thread_index() == 0) {
+        g_queue<Queue> = std::make_unique<Queue>(kRing);
+        for (std::size_t i = 0; i < kBacklog; ++i) {
+            g_queue<Queue>->enqueue(i & kValueMask);
+        }
+    }
+
+    std::uint64_t v = static_cast<std::uint64_t>(state.thread_index());
+    for (auto _ : state) {
+        g_queue<Queue>->enqueue(v);
+        benchmark::DoNotOptimize(g_queue<Queue>->dequeue());
+        v = (v + 1) & kValueMask;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+    if (state.thread_index() == 0) {
+        add_remap_counters<Queue>(state);
+        g_queue<Queue>.reset();
+    }
+}
+
+template <class Remap>
+void BM_SCQ_Bulk(benchmark::State& state) {
+    using Queue = ScqOf<Remap>;
+    if (state.thread_index() == 0) {
+        g_queue<Queue> = std::make_unique<Queue>(kRing);
+        for (std::size_t i = 0; i < kBacklog; ++i) {
+            g_queue<Queue>->enqueue(i & kValueMask);
+        }
+    }
+
+    std::uint64_t in[kBatch];
+    std::uint64_t out[kBatch];
+    for (std::size_t i = 0; i < kBatch; ++i) {
+        in[i] = (static_cast<std::uint64_t>(state.thread_index()) * kBatch + i) & kValueMask;
+    }
+    for (auto _ : state) {
+        g_queue<Queue>->enqueue_bulk(in, kBatch);
+        benchmark::DoNotOptimize(g_queue<Queue>->dequeue_bulk(out, kBatch));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch) * 2);
+    if (state.thread_index() == 0) {
+        add_remap_counters<Queue>(state);
+        g_queue<Queue>.reset();
+    }
+}
+
+template <class Remap>
+void BM_SCQP_Pair(benchmark::State& state) {
+    using Queue = ScqpOf<Remap>;
+    if (state.thread_index() == 0) {
+        g_queue<Queue> = std::make_unique<Queue>(kRing);
+        for (std::size_t i = 0; i < kBacklog; ++i) {
+            g_queue<Queue>->enqueue(&g_values[i & kValueMask]);
+        }
+    }
+
+    std::size_t v = static_cast<std::size_t>(state.thread_index());
+    for (auto _ : state) {
+        // The backlog plus one item per thread never reaches capacity, so enqueue cannot fail.
+        g_queue<Queue>->enqueue(&g_values[v]);
+        benchmark::DoNotOptimize(g_queue<Queue>->dequeue());
+        v = (v + 1) & kValueMask;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+    if (state.thread_index() == 0) {
+        add_remap_counters<Queue>(state);
+        g_queue<Queue>.reset();
+    }
+}
+
+template <class Remap>
+void BM_SCQP_Bulk(benchmark::State& state) {
+    using Queue = ScqpOf<Remap>;
+    if (state.thread_index() == 0) {
+        g_queue<Queue> = std::make_unique<Queue>(kRing);
+        for (std::size_t i = 0; i < kBacklog; ++i) {
+            g_queue<Queue>->enqueue(&g_values[i & kValueMask]);
+        }
+    }
+
+    std::uint64_t* in[kBatch];
+    std::uint64_t* out[kBatch];
+    for (std::size_t i = 0; i < kBatch; ++i) {
+        in[i] = &g_values[(static_cast<std::size_t>(state.thread_index()) * kBatch + i) &
+                          kValueMask];
+    }
+    for (auto _ : state) {
+        g_queue<Queue>->enqueue_bulk(in, kBatch);
+        benchmark::DoNotOptimize(g_queue<Queue>->dequeue_bulk(out, kBatch));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kBatch) * 2);
+    if (state.thread_index() == 0) {
+        add_remap_counters<Queue>(state);
+        g_queue<Queue>.reset();
+    }
+}
+
+void apply_threads(benchmark::internal::Benchmark* b) {
+    b->ThreadRange(1, 16);
+    b->UseRealTime();
+}
+
+}  // namespace
+
+#define LSCQ_REMAP_BENCHMARKS(BM)                                          \
+    BENCHMARK_TEMPLATE(BM, lscq::IdentityRemap)->Apply(apply_threads);     \
+    BENCHMARK_TEMPLATE(BM, lscq::DefaultRemap)->Apply(apply_threads);      \
+    BENCHMARK_TEMPLATE(BM, lscq::AdjacentLineRemap)->Apply(apply_threads); \
+    BENCHMARK_TEMPLATE(BM, CustomStride)->Apply(apply_threads)
+
+LSCQ_REMAP_BENCHMARKS(BM_SCQ_Pair);
+LSCQ_REMAP_BENCHMARKS(BM_SCQ_Bulk);
+LSCQ_REMAP_BENCHMARKS(BM_SCQP_Pair);
+LSCQ_REMAP_BENCHMARKS(BM_SCQP_Bulk);
@@ -0,0 +1,160 @@
+// Ring size sweep with and without huge-page backed rings.
+//
+// cache_remap spreads consecutive tickets over four quarters of the ring, and a queue with a
+// backlog keeps Head and Tail far apart, so a large ring touches many 4 KiB pages at once. Each
+// benchmark keeps half of the usable capacity queued and then does one enqueue + one dequeue per
+// iteration, for rings of 4K..16M entries with huge_pages=0 (aligned heap) and huge_pages=1
+// (RingPlacement::huge(): MAP_HUGETLB or MADV_HUGEPAGE, see placement.hpp).
+//
+// The "huge_pages_used" counter reports what the ring actually got: with no hugetlbfs pool and THP
+// set to "never" the huge_pages=1 rows fall back to the heap and should match huge_pages=0.
+//
+// The *_Construct benchmarks create and destroy one queue per iteration for rings of 1K..16M
+// entries. Rings start as zeroed, lazily committed memory that no constructor writes, so their
+// cost should stay nearly flat instead of growing with the ring's bytes.
+
+#include <lscq/ncq.hpp>
+#include <lscq/placement.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scq64.hpp>
+#include <lscq/scqp.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Cap the backlog so 16M-entry rings do not spend most of the run prefilling.
+constexpr std::size_t kMaxBacklog = std::size_t{1} << 22;
+// Values stay below the smallest ring's bottom marker (SCQ rejects values >= scqsize - 1).
+constexpr std::uint64_t kValueMask = 1023;
+
+lscq::RingPlacement placement_for(const benchmark::State& state) {
+    return state.range(1) != 0 ? lscq::RingPlacement::huge() : lscq::RingPlacement{};
+}
+
+template <class Queue>
+void add_ring_counters(benchmark::State& state, const Queue& q, std::size_t entry_bytes) {
+    state.counters["ring_entries"] = static_cast<double>(q.scqsize());
+    state.counters["ring_MiB"] =
+        static_cast<double>(q.scqsize() * entry_bytes) / static_cast<double>(1u << 20);
+    state.counters["huge_pages_used"] = q.ring_on_huge_pages() ? 1.0 : 0.0;
+}
+
+// Shared between the benchmark threads: thread 0 builds it before the timed loop (the loop start
+// is a barrier for all threads) and destroys it after the loop (the loop end is one as well).
+std::unique_ptr<lscq::SCQ<std::uint64_t>> g_scq;
+
+void BM_SCQ_RingSize(benchmark::State& state) {
+    const std::size_t ring = static_cast<std::size_t>(state.range(0));
+    if (state.thread_index() == 0) {
+        g_scq = std::make_unique<lscq::SCQ<std::uint64_t>>(ring, placement_for(state));
+        const std::size_t backlog = std::min(g_scq->qsize() / 2, kMaxBacklog);
+        for (std::size_t i = 0; i < backlog; ++i) {
+            g_scq->enqueue(i & kValueMask);
+        }
+    }
+
+    std::uint64_t v = static_cast<std::uint64_t>(state.thread_index());
+    for (auto _ : state) {
+        g_scq->enqueue(v);
+        benchmark::DoNotOptimize(g_scq->dequeue());
+        v = (v + 1) & kValueMask;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+    if (state.thread_index() == 0) {
+        add_ring_counters(state, *g_scq, sizeof(lscq::Entry));
+        g_scq.reset();
+    }
+}
+
+std::unique_ptr<lscq::SCQP<std::uint64_t>> g_scqp;
+std::vector<std::uint64_t> g_values(kValueMask + 1);
+
+void BM_SCQP_RingSize(benchmark::State& state) {
+    const std::size_t ring = static_cast<std::size_t>(state.range(0));
+    if (state.thread_index() == 0) {
+        g_scqp = std::make_unique<lscq::SCQP<std::uint64_t>>(ring, placement_for(state));
+        const std::size_t backlog = std::min(g_scqp->qsize() / 2, kMaxBacklog);
+        for (std::size_t i = 0; i < backlog; ++i) {
+            g_scqp->enqueue(&g_values[i & kValueMask]);
+        }
+    }
+
+    std::size_t v = static_cast<std::size_t>(state.thread_index());
+    for (auto _ : state) {
+        // The backlog plus one item per thread never reaches capacity, so enqueue cannot fail.
+        g_scqp->enqueue(&g_values[v]);
+        benchmark::DoNotOptimize(g_scqp->dequeue());
+        v = (v + 1) & kValueMask;
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+    if (state.thread_index() == 0) {
+        add_ring_counters(state, *g_scqp, sizeof(lscq::Entry));
+        state.counters["using_fallback"] = g_scqp->is_using_fallback() ? 1.0 : 0.0;
+        g_scqp.reset();
+    }
+}
+
+template <class Queue, std::size_t kSlotBytes = sizeof(lscq::Entry)>
+void BM_Construct(benchmark::State& state) {
+    const std::size_t ring = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        Queue q(ring);
+        benchmark::DoNotOptimize(&q);
+    }
+    state.counters["ring_entries"] = static_cast<double>(ring);
+    state.counters["ring_MiB"] =
+        static_cast<double>(ring * kSlotBytes) / static_cast<double>(1u << 20);
+}
+
+// SCQP's index-ring fallback: its pointer slots and aq start zeroed, but fq is filled with every
+// slot index, so this row is expected to grow with the ring.
+void BM_SCQPFallback_Construct(benchmark::State& state) {
+    const std::size_t ring = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        lscq::SCQP<std::uint64_t> q(ring, /*force_fallback=*/true);
+        benchmark::DoNotOptimize(&q);
+    }
+    state.counters["ring_entries"] = static_cast<double>(ring);
+}
+
+// 1K, 4K, ..., 16M entries.
+void apply_construct_sizes(benchmark::internal::Benchmark* b) {
+    b->ArgName("entries");
+    b->RangeMultiplier(4)->Range(1 << 10, 1 << 24);
+}
+
+// 4K, 16K, ..., 16M entries x {heap, huge pages}.
+void apply_ring_sizes(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"entries", "huge_pages"});
+    b->RangeMultiplier(4)->Ranges({{1 << 12, 1 << 24}, {0, 1}});
+    b->Threads(1)->Threads(4);
+    b->UseRealTime();
+}
+
+}  // namespace
+
+BENCHMARK(BM_SCQ_RingSize)->Apply(apply_ring_sizes);
+BENCHMARK(BM_SCQP_RingSize)->Apply(apply_ring_sizes);
+
+BENCHMARK(BM_Construct<lscq::NCQ<std::uint64_t>>)
+    ->Name("BM_NCQ_Construct")
+    ->Apply(apply_construct_sizes);
+BENCHMARK(BM_Construct<lscq::SCQ<std::uint64_t>>)
+    ->Name("BM_SCQ_Construct")
+    ->Apply(apply_construct_sizes);
+BENCHMARK(BM_Construct<lscq::SCQP<std::uint64_t>>)
+    ->Name("BM_SCQP_Construct")
+    ->Apply(apply_construct_sizes);
+BENCHMARK(BM_Construct<lscq::SCQ64<std::uint64_t>, sizeof(std::uint64_t)>)
+    ->Name("BM_SCQ64_Construct")
+    ->Apply(apply_construct_sizes);
+BENCHMARK(BM_SCQPFallback_Construct)->Apply(apply_construct_sizes);
@@ -1,5 +1,7 @@
+#include <lscq/fixed_scq.hpp>
 #include <lscq/ncq.hpp>
 #include <lscq/scq.hpp>
+#include <lscq/scq64.hpp>
 
 #include <benchmark/benchmark.h>
 
@@ -10,6 +12,7 @@
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <type_traits>
 
 namespace {
 
@@ -64,6 +67,7 @@ inline std::size_t scqsize_for_effective_capacity(std::size_t effective_capacity
 
 }  // namespace
 
+template <class Queue>
 static void BM_SCQ_Pair(benchmark::State& state) {
     using Value = std::uint64_t;
 
@@ -82,7 +86,7 @@ static void BM_SCQ_Pair(benchmark::State& state) {
             state.PauseTiming();
             const std::size_t effective_capacity = kOpsPerThread + 1024;
             const std::size_t scqsize = scqsize_for_effective_capacity(effective_capacity);
-            lscq::SCQ<Value> q(scqsize);
+            auto q = std::make_unique<Queue>(scqsize);
             state.counters["scqsize"] =
                 benchmark::Counter(static_cast<double>(scqsize), benchmark::Counter::kAvgThreads);
             state.counters["qsize"] = benchmark::Counter(static_cast<double>(effective_capacity),
@@ -90,23 +94,27 @@ static void BM_SCQ_Pair(benchmark::State& state) {
             state.ResumeTiming();
 
             for (std::size_t i = 0; i < kOpsPerThread; ++i) {
-                (void)q.enqueue(static_cast<Value>(i));
+                (void)q->enqueue(static_cast<Value>(i));
             }
 
+            // Keep ring teardown out of the measurement, and leave the timer running as the
+            // benchmark loop requires.
             state.PauseTiming();
+            q.reset();
+            state.ResumeTiming();
         }
         return;
     }
 
     struct Context {
         explicit Context(int threads, std::size_t scqsize, std::size_t qsize)
-            : q(std::make_unique<lscq::SCQ<Value>>(scqsize)),
+            : q(std::make_unique<Queue>(scqsize)),
               start(threads),
               finish(threads),
               scqsize(scqsize),
               qsize(qsize) {}
 
-        std::unique_ptr<lscq::SCQ<Value>> q;
+        std::unique_ptr<Queue> q;
         CyclicBarrier start;
         CyclicBarrier finish;
         std::size_t scqsize;
@@ -145,7 +153,7 @@ static void BM_SCQ_Pair(benchmark::State& state) {
             std::size_t done = 0;
             while (done < kOpsPerThread) {
                 const Value v = ctx->q->dequeue();
-                if (v == lscq::SCQ<Value>::kEmpty) {
+                if (v == Queue::kEmpty) {
                     continue;
                 }
                 benchmark::DoNotOptimize(v);
@@ -241,6 +249,7 @@ static void BM_NCQ_MultiEnqueue(benchmark::State& state) {
     }
 }
 
+template <class Queue>
 static void BM_SCQ_MultiEnqueue(benchmark::State& state) {
     using Value = std::uint64_t;
 
@@ -257,14 +266,14 @@ static void BM_SCQ_MultiEnqueue(benchmark::State& state) {
 
     struct Context {
         explicit Context(int threads, std::size_t scqsize, std::size_t qsize, std::uint64_t value_mask)
-            : q(std::make_unique<lscq::SCQ<Value>>(scqsize)),
+            : q(std::make_unique<Queue>(scqsize)),
               start(threads),
               finish(threads),
               scqsize(scqsize),
               qsize(qsize),
               value_mask(value_mask) {}
 
-        std::unique_ptr<lscq::SCQ<Value>> q;
+        std::unique_ptr<Queue> q;
         CyclicBarrier start;
         CyclicBarrier finish;
         std::size_t scqsize;
@@ -305,7 +314,7 @@ static void BM_SCQ_MultiEnqueue(benchmark::State& state) {
             std::uint64_t done = 0;
             while (done < total_enqueues) {
                 const Value v = ctx->q->dequeue();
-                if (v == lscq::SCQ<Value>::kEmpty) {
+                if (v == Queue::kEmpty) {
                     std::this_thread::yield();
                     continue;
                 }
@@ -400,6 +409,7 @@ static void BM_NCQ_MultiDequeue(benchmark::State& state) {
     }
 }
 
+template <class Queue>
 static void BM_SCQ_MultiDequeue(benchmark::State& state) {
     using Value = std::uint64_t;
 
@@ -416,14 +426,14 @@ static void BM_SCQ_MultiDequeue(benchmark::State& state) {
 
     struct Context {
         explicit Context(int threads, std::size_t scqsize, std::size_t qsize, std::uint64_t value_mask)
-            : q(std::make_unique<lscq::SCQ<Value>>(scqsize)),
+            : q(std::make_unique<Queue>(scqsize)),
               start(threads),
               finish(threads),
               scqsize(scqsize),
               qsize(qsize),
               value_mask(value_mask) {}
 
-        std::unique_ptr<lscq::SCQ<Value>> q;
+        std::unique_ptr<Queue> q;
         CyclicBarrier start;
         CyclicBarrier finish;
         std::size_t scqsize;
@@ -462,7 +472,7 @@ static void BM_SCQ_MultiDequeue(benchmark::State& state) {
             std::size_t done = 0;
             while (done < kOpsPerThread) {
                 const Value v = ctx->q->dequeue();
-                if (v == lscq::SCQ<Value>::kEmpty) {
+                if (v == Queue::kEmpty) {
                     std::this_thread::yield();
                     continue;
                 }
@@ -481,28 +491,71 @@ static void BM_SCQ_MultiDequeue(benchmark::State& state) {
     }
 }
 
-BENCHMARK(BM_SCQ_Pair)->Threads(1)->UseRealTime();
-BENCHMARK(BM_SCQ_Pair)->Threads(2)->UseRealTime();
-BENCHMARK(BM_SCQ_Pair)->Threads(4)->UseRealTime();
-BENCHMARK(BM_SCQ_Pair)->Threads(8)->UseRealTime();
-BENCHMARK(BM_SCQ_Pair)->Threads(16)->UseRealTime();
+// Single-thread enqueue/dequeue round trip on a fixed ring size: isolates the per-operation cost of
+// SCQ's runtime shift/mask/remap against FixedSCQ's compile-time constants and inline ring.
+constexpr std::size_t kRoundTripScqSize = 1u << 16;
+
+template <class Queue>
+static void BM_SCQ_RoundTrip(benchmark::State& state) {
+    std::unique_ptr<Queue> q;
+    if constexpr (std::is_constructible_v<Queue, std::size_t>) {
+        q = std::make_unique<Queue>(kRoundTripScqSize);
+    } else {
+        q = std::make_unique<Queue>();
+    }
+
+    std::uint64_t v = 0;
+    for (auto _ : state) {
+        q->enqueue(v);
+        benchmark::DoNotOptimize(q->dequeue());
+        v = (v + 1) & 1023u;
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * 2);
+}
+
+BENCHMARK(BM_SCQ_RoundTrip<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_RoundTrip");
+BENCHMARK(BM_SCQ_RoundTrip<lscq::FixedSCQ<std::uint64_t, kRoundTripScqSize>>)
+    ->Name("BM_FixedSCQ_RoundTrip");
+
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_Pair")->Threads(1)->UseRealTime();
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_Pair")->Threads(2)->UseRealTime();
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_Pair")->Threads(4)->UseRealTime();
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_Pair")->Threads(8)->UseRealTime();
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_Pair")->Threads(16)->UseRealTime();
 
 BENCHMARK(BM_NCQ_MultiEnqueue)->Threads(3)->UseRealTime();
 BENCHMARK(BM_NCQ_MultiEnqueue)->Threads(5)->UseRealTime();
 BENCHMARK(BM_NCQ_MultiEnqueue)->Threads(9)->UseRealTime();
 BENCHMARK(BM_NCQ_MultiEnqueue)->Threads(17)->UseRealTime();
 
-BENCHMARK(BM_SCQ_MultiEnqueue)->Threads(3)->UseRealTime();
-BENCHMARK(BM_SCQ_MultiEnqueue)->Threads(5)->UseRealTime();
-BENCHMARK(BM_SCQ_MultiEnqueue)->Threads(9)->UseRealTime();
-BENCHMARK(BM_SCQ_MultiEnqueue)->Threads(17)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiEnqueue<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_MultiEnqueue")->Threads(3)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiEnqueue<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_MultiEnqueue")->Threads(5)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiEnqueue<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_MultiEnqueue")->Threads(9)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiEnqueue<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_MultiEnqueue")->Threads(17)->UseRealTime();
 
 BENCHMARK(BM_NCQ_MultiDequeue)->Threads(3)->UseRealTime();
 BENCHMARK(BM_NCQ_MultiDequeue)->Threads(5)->UseRealTime();
 BENCHMARK(BM_NCQ_MultiDequeue)->Threads(9)->UseRealTime();
 BENCHMARK(BM_NCQ_MultiDequeue)->Threads(17)->UseRealTime();
 
-BENCHMARK(BM_SCQ_MultiDequeue)->Threads(3)->UseRealTime();
-BENCHMARK(BM_SCQ_MultiDequeue)->Threads(5)->UseRealTime();
-BENCHMARK(BM_SCQ_MultiDequeue)->Threads(9)->UseRealTime();
-BENCHMARK(BM_SCQ_MultiDequeue)->Threads(17)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiDequeue<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_MultiDequeue")->Threads(3)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiDequeue<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_MultiDequeue")->Threads(5)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiDequeue<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_MultiDequeue")->Threads(9)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiDequeue<lscq::SCQ<std::uint64_t>>)->Name("BM_SCQ_MultiDequeue")->Threads(17)->UseRealTime();
+
+// SCQ64: same algorithm with 8-byte entries (no CAS2).
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_Pair")->Threads(1)->UseRealTime();
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_Pair")->Threads(2)->UseRealTime();
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_Pair")->Threads(4)->UseRealTime();
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_Pair")->Threads(8)->UseRealTime();
+BENCHMARK(BM_SCQ_Pair<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_Pair")->Threads(16)->UseRealTime();
+
+BENCHMARK(BM_SCQ_MultiEnqueue<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_MultiEnqueue")->Threads(3)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiEnqueue<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_MultiEnqueue")->Threads(5)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiEnqueue<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_MultiEnqueue")->Threads(9)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiEnqueue<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_MultiEnqueue")->Threads(17)->UseRealTime();
+
+BENCHMARK(BM_SCQ_MultiDequeue<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_MultiDequeue")->Threads(3)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiDequeue<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_MultiDequeue")->Threads(5)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiDequeue<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_MultiDequeue")->Threads(9)->UseRealTime();
+BENCHMARK(BM_SCQ_MultiDequeue<lscq::SCQ64<std::uint64_t>>)->Name("BM_SCQ64_MultiDequeue")->Threads(17)->UseRealTime();
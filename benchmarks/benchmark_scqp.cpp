@@ -369,6 +369,70 @@ static void BM_SCQP_MultiDequeue(benchmark::State& state) {
     }
 }
 
+// CAS2 ring vs. index-ring fallback on the same shared queue. Arg(0) lets SCQP choose (the CAS2
+// ring when the CPU has it), Arg(1) passes force_fallback=true. Each iteration is one enqueue + one
+// dequeue (or one kFallbackBatch bulk round trip) over a short backlog, so both modes stay well
+// below capacity and only the slot protocol differs.
+namespace {
+
+constexpr std::size_t kFallbackRing = 1u << 12;
+constexpr std::size_t kFallbackBacklog = 64;
+constexpr std::size_t kFallbackBatch = 16;
+constexpr std::size_t kModeValueMask = 1023;
+
+// Built by thread 0 before the timed loop and destroyed after it. Only the loop boundaries are
+// barriers, so the other threads may touch it only inside the loop.
+std::unique_ptr<lscq::SCQP<std::uint64_t>> g_mode_queue;
+std::vector<std::uint64_t> g_mode_values(kModeValueMask + 1);
+
+void setup_mode_queue(benchmark::State& state) {
+    if (state.thread_index() == 0) {
+        g_mode_queue =
+            std::make_unique<lscq::SCQP<std::uint64_t>>(kFallbackRing, state.range(0) != 0);
+        for (std::size_t i = 0; i < kFallbackBacklog; ++i) {
+            g_mode_queue->enqueue(&g_mode_values[i]);
+        }
+    }
+}
+
+void teardown_mode_queue(benchmark::State& state, std::size_t items_per_iteration) {
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * items_per_iteration));
+    if (state.thread_index() == 0) {
+        state.counters["using_fallback"] = g_mode_queue->is_using_fallback() ? 1.0 : 0.0;
+        state.counters["has_cas2_support"] = lscq::has_cas2_support() ? 1.0 : 0.0;
+        g_mode_queue.reset();
+    }
+}
+
+}  // namespace
+
+static void BM_SCQP_ModePair(benchmark::State& state) {
+    setup_mode_queue(state);
+    std::size_t v = static_cast<std::size_t>(state.thread_index());
+    for (auto _ : state) {
+        g_mode_queue->enqueue(&g_mode_values[v]);
+        benchmark::DoNotOptimize(g_mode_queue->dequeue());
+        v = (v + 1) & kModeValueMask;
+    }
+    teardown_mode_queue(state, 2);
+}
+
+static void BM_SCQP_ModeBulk(benchmark::State& state) {
+    setup_mode_queue(state);
+    std::uint64_t* in[kFallbackBatch];
+    std::uint64_t* out[kFallbackBatch];
+    for (std::size_t i = 0; i < kFallbackBatch; ++i) {
+        const std::size_t slot =
+            static_cast<std::size_t>(state.thread_index()) * kFallbackBatch + i;
+        in[i] = &g_mode_values[slot & kModeValueMask];
+    }
+    for (auto _ : state) {
+        g_mode_queue->enqueue_bulk(in, kFallbackBatch);
+        benchmark::DoNotOptimize(g_mode_queue->dequeue_bulk(out, kFallbackBatch));
+    }
+    teardown_mode_queue(state, 2 * kFallbackBatch);
+}
+
 BENCHMARK(BM_SCQP_Pair)->Threads(1)->UseRealTime();
 BENCHMARK(BM_SCQP_Pair)->Threads(2)->UseRealTime();
 BENCHMARK(BM_SCQP_Pair)->Threads(4)->UseRealTime();
@@ -385,3 +449,7 @@ BENCHMARK(BM_SCQP_MultiDequeue)->Threads(5)->UseRealTime();
 BENCHMARK(BM_SCQP_MultiDequeue)->Threads(9)->UseRealTime();
 BENCHMARK(BM_SCQP_MultiDequeue)->Threads(17)->UseRealTime();
 
+BENCHMARK(BM_SCQP_ModePair)->ArgName("force_fallback")->Arg(0)->Arg(1)->ThreadRange(1, 16)
+    ->UseRealTime();
+BENCHMARK(BM_SCQP_ModeBulk)->ArgName("force_fallback")->Arg(0)->Arg(1)->ThreadRange(1, 16)
+    ->UseRealTime();
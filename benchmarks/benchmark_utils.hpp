@@ -7,6 +7,8 @@
 #include <lscq/ncq.hpp>
 #include <lscq/scq.hpp>
 #include <lscq/scqp.hpp>
+#include <lscq/sharded_queue.hpp>
+#include <lscq/wait_policy.hpp>
 
 #include <benchmark/benchmark.h>
 
@@ -122,11 +124,19 @@ inline void add_common_counters(benchmark::State& state, int producers, int cons
 template <class Queue>
 struct QueueOps;
 
+// Match a queue family regardless of its policies, e.g. is_queue_family_v<Q, lscq::SCQ>.
+template <class Queue, template <class...> class Family>
+struct is_queue_family : std::false_type {};
+template <class... Args, template <class...> class Family>
+struct is_queue_family<Family<Args...>, Family> : std::true_type {};
+template <class Queue, template <class...> class Family>
+inline constexpr bool is_queue_family_v = is_queue_family<Queue, Family>::value;
+
 using Value = std::uint64_t;
 
-template <>
-struct QueueOps<lscq::NCQ<Value>> {
-    using queue_type = lscq::NCQ<Value>;
+template <class WaitPolicy>
+struct QueueOps<lscq::NCQ<Value, WaitPolicy>> {
+    using queue_type = lscq::NCQ<Value, WaitPolicy>;
     using item_type = Value;
     static constexpr bool kPointerQueue = false;
 
@@ -148,9 +158,9 @@ struct QueueOps<lscq::NCQ<Value>> {
     }
 };
 
-template <>
-struct QueueOps<lscq::SCQ<Value>> {
-    using queue_type = lscq::SCQ<Value>;
+template <class WaitPolicy>
+struct QueueOps<lscq::SCQ<Value, WaitPolicy>> {
+    using queue_type = lscq::SCQ<Value, WaitPolicy>;
     using item_type = Value;
     static constexpr bool kPointerQueue = false;
 
@@ -178,6 +188,14 @@ struct QueueOps<lscq::SCQ<Value>> {
         out = v;
         return true;
     }
+
+    static std::size_t enqueue_bulk(queue_type& q, const item_type* items, std::size_t n) {
+        return q.enqueue_bulk(items, n);
+    }
+
+    static std::size_t dequeue_bulk(queue_type& q, item_type* out, std::size_t n) {
+        return q.dequeue_bulk(out, n);
+    }
 };
 
 template <>
@@ -214,9 +232,9 @@ struct QueueOps<lscq::MutexQueue<Value>> {
     static bool dequeue(queue_type& q, item_type& out) { return q.dequeue(out); }
 };
 
-template <>
-struct QueueOps<lscq::SCQP<Value>> {
-    using queue_type = lscq::SCQP<Value>;
+template <class WaitPolicy>
+struct QueueOps<lscq::SCQP<Value, WaitPolicy>> {
+    using queue_type = lscq::SCQP<Value, WaitPolicy>;
     using item_type = Value*;
     static constexpr bool kPointerQueue = true;
 
@@ -237,17 +255,26 @@ struct QueueOps<lscq::SCQP<Value>> {
         out = p;
         return true;
     }
+
+    static std::size_t enqueue_bulk(queue_type& q, const item_type* items, std::size_t n) {
+        return q.enqueue_bulk(items, n);
+    }
+
+    static std::size_t dequeue_bulk(queue_type& q, item_type* out, std::size_t n) {
+        return q.dequeue_bulk(out, n);
+    }
 };
 
-struct LSCQContext {
+template <class WaitPolicy = lscq::DefaultWaitPolicy>
+struct BasicLSCQContext {
     lscq::EBRManager ebr;
-    lscq::LSCQ<Value> q;
+    lscq::LSCQ<Value, WaitPolicy> q;
     CyclicBarrier start;
     CyclicBarrier finish;
     std::vector<Value> pool;
     std::uint64_t pool_mask;
 
-    explicit LSCQContext(int threads, std::size_t node_scqsize)
+    explicit BasicLSCQContext(int threads, std::size_t node_scqsize)
         : ebr(),
           q(ebr, node_scqsize),
           start(threads),
@@ -260,16 +287,49 @@ struct LSCQContext {
     }
 };
 
-template <>
-struct QueueOps<lscq::LSCQ<Value>> {
-    using queue_type = lscq::LSCQ<Value>;
+using LSCQContext = BasicLSCQContext<>;
+
+template <class WaitPolicy>
+struct QueueOps<lscq::LSCQ<Value, WaitPolicy>> {
+    using queue_type = lscq::LSCQ<Value, WaitPolicy>;
     using item_type = Value*;
     static constexpr bool kPointerQueue = true;
-    using context_type = LSCQContext;
+    using context_type = BasicLSCQContext<WaitPolicy>;
 
     static constexpr const char* name() { return "LSCQ"; }
 };
 
+// ShardedQueue over LSCQ lanes: one lane per hardware thread, so on the 24-thread reference box
+// every benchmark thread gets its own home lane. Capacity is unbounded, as for plain LSCQ.
+template <class WaitPolicy>
+struct QueueOps<lscq::ShardedQueue<lscq::LSCQ<Value, WaitPolicy>>> {
+    using queue_type = lscq::ShardedQueue<lscq::LSCQ<Value, WaitPolicy>>;
+    using item_type = Value*;
+    static constexpr bool kPointerQueue = true;
+
+    static constexpr const char* name() { return "ShardedLSCQ"; }
+
+    static std::size_t lane_count() {
+        const unsigned hc = std::thread::hardware_concurrency();
+        return hc == 0 ? 1u : static_cast<std::size_t>(hc);
+    }
+
+    static std::unique_ptr<queue_type> make_queue(std::size_t /*effective_capacity*/) {
+        return std::make_unique<queue_type>(lane_count(), kLSCQNodeScqsize);
+    }
+
+    static bool enqueue(queue_type& q, item_type p) { return q.enqueue(p); }
+
+    static bool dequeue(queue_type& q, item_type& out) {
+        item_type p = q.dequeue();
+        if (p == nullptr) {
+            return false;
+        }
+        out = p;
+        return true;
+    }
+};
+
 template <class Queue>
 struct SharedContext {
     using ops = QueueOps<Queue>;
@@ -295,7 +355,7 @@ struct SharedContext {
                 pool[i] = static_cast<Value>(i);
             }
         }
-        if constexpr (std::is_same_v<queue_type, lscq::SCQ<Value>>) {
+        if constexpr (is_queue_family_v<queue_type, lscq::SCQ>) {
             scq_value_mask = ops::value_mask(*q);
         }
     }
@@ -308,7 +368,7 @@ struct SharedContext {
             return &pool[static_cast<std::size_t>(idx)];
         } else {
             Value v = (static_cast<std::uint64_t>(thread_index) << 32u) + seq;
-            if constexpr (std::is_same_v<queue_type, lscq::SCQ<Value>>) {
+            if constexpr (is_queue_family_v<queue_type, lscq::SCQ>) {
                 v &= scq_value_mask;
             }
             if (v == (std::numeric_limits<Value>::max)()) {
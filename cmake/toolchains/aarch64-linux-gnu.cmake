@@ -12,3 +12,14 @@ if(EXISTS "/usr/aarch64-linux-gnu")
   set(CMAKE_SYSROOT "/usr/aarch64-linux-gnu")
   set(CMAKE_FIND_ROOT_PATH "/usr/aarch64-linux-gnu")
 endif()
+
+# Run target binaries (tests, gtest discovery) through qemu-user when it is installed, so the
+# memory-order litmus tests execute on an AArch64 (weakly ordered) instruction stream.
+find_program(LSCQ_QEMU_AARCH64 NAMES qemu-aarch64-static qemu-aarch64 NO_CMAKE_FIND_ROOT_PATH)
+if(LSCQ_QEMU_AARCH64)
+  if(EXISTS "/usr/aarch64-linux-gnu")
+    set(CMAKE_CROSSCOMPILING_EMULATOR "${LSCQ_QEMU_AARCH64};-L;/usr/aarch64-linux-gnu")
+  else()
+    set(CMAKE_CROSSCOMPILING_EMULATOR "${LSCQ_QEMU_AARCH64}")
+  endif()
+endif()
@@ -0,0 +1,267 @@
+/**
+ * @file blocking_queue.hpp
+ * @brief Blocking (park/unpark) wrapper around the lock-free queues.
+ * @author lscq contributors
+ * @version 0.1.0
+ *
+ * BlockingQueue layers an eventcount on top of NCQ, SCQ, SCQP or LSCQ so consumers can sleep while
+ * the queue is empty (and producers can sleep while a bounded queue is full) instead of polling.
+ * The wrapped queue's lock-free enqueue/dequeue paths are used unchanged.
+ */
+
+#ifndef LSCQ_BLOCKING_QUEUE_HPP_
+#define LSCQ_BLOCKING_QUEUE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <lscq/config.hpp>
+#include <lscq/detail/event_count.hpp>
+#include <lscq/lscq.hpp>
+#include <lscq/ncq.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scqp.hpp>
+#include <utility>
+
+namespace lscq {
+
+namespace detail {
+
+/**
+ * @brief Adapts a queue type to the interface BlockingQueue needs.
+ *
+ * - `value_type` / `empty_value()`: element type and the "nothing dequeued" sentinel.
+ * - `kBounded`: whether BlockingQueue offers @c enqueue_wait for this queue.
+ * - `kReportsFull`: for bounded queues, whether enqueue itself fails when full. If not,
+ *   BlockingQueue keeps its own free-slot credits so enqueue never reaches the full ring.
+ */
+template <class Queue>
+struct BlockingQueueTraits;
+
+// NCQ overwrites instead of reporting full, so callers must bound occupancy themselves.
+template <class T, class W, class R>
+struct BlockingQueueTraits<NCQ<T, W, R>> {
+    using value_type = T;
+    static constexpr bool kBounded = false;
+    static constexpr bool kReportsFull = false;
+    static constexpr value_type empty_value() noexcept { return NCQ<T, W, R>::kEmpty; }
+    static std::size_t capacity(const NCQ<T, W, R>&) noexcept { return 0; }
+};
+
+// SCQ spins inside enqueue when full, so BlockingQueue gates producers with qsize() credits.
+template <class T, class W, class R>
+struct BlockingQueueTraits<SCQ<T, W, R>> {
+    using value_type = T;
+    static constexpr bool kBounded = true;
+    static constexpr bool kReportsFull = false;
+    static constexpr value_type empty_value() noexcept { return SCQ<T, W, R>::kEmpty; }
+    static std::size_t capacity(const SCQ<T, W, R>& q) noexcept { return q.qsize(); }
+};
+
+template <class T, class W, class R>
+struct BlockingQueueTraits<SCQP<T, W, R>> {
+    using value_type = T*;
+    static constexpr bool kBounded = true;
+    static constexpr bool kReportsFull = true;
+    static constexpr value_type empty_value() noexcept { return nullptr; }
+    static std::size_t capacity(const SCQP<T, W, R>& q) noexcept { return q.scqsize(); }
+};
+
+template <class T, class W, class P>
+struct BlockingQueueTraits<LSCQ<T, W, P>> {
+    using value_type = T*;
+    static constexpr bool kBounded = false;
+    static constexpr bool kReportsFull = false;
+    static constexpr value_type empty_value() noexcept { return nullptr; }
+    static std::size_t capacity(const LSCQ<T, W, P>&) noexcept { return 0; }
+};
+
+}  // namespace detail
+
+/**
+ * @class BlockingQueue
+ * @brief Adds blocking dequeue (and, for bounded queues, blocking enqueue) to a lock-free queue.
+ *
+ * Producers notify an eventcount after each successful enqueue and consumers notify after each
+ * successful dequeue of a bounded queue. While no thread is parked a notification costs one fence
+ * and one load; the futex syscall only happens when somebody is actually asleep.
+ *
+ * @tparam Queue One of NCQ<T>, SCQ<T>, SCQP<T> or LSCQ<T>.
+ *
+ * Thread-safety: all public methods are safe for concurrent callers. Producers and consumers must
+ * go through this wrapper (not @ref queue()) for wakeups and, for SCQ, capacity accounting to
+ * stay accurate.
+ *
+ * Example:
+ * @code
+ * lscq::BlockingQueue<lscq::SCQP<Job>> q(1024);
+ * q.enqueue_wait(job);                       // sleeps while full
+ * Job* j = q.dequeue_for(std::chrono::milliseconds(5));  // nullptr on timeout
+ * @endcode
+ */
+template <class Queue>
+class BlockingQueue {
+    using Traits = detail::BlockingQueueTraits<Queue>;
+
+   public:
+    /** @brief Element type accepted by enqueue and returned by dequeue. */
+    using value_type = typename Traits::value_type;
+    /** @brief Wrapped queue type. */
+    using queue_type = Queue;
+
+    /** @brief Whether @ref enqueue_wait is available for this queue type. */
+    static constexpr bool kBounded = Traits::kBounded;
+
+    /**
+     * @brief Construct the wrapped queue in place.
+     * @param args Arguments forwarded to the @p Queue constructor.
+     */
+    template <class... Args>
+    explicit BlockingQueue(Args&&... args) : queue_(std::forward<Args>(args)...) {
+        credits_.store(static_cast<std::int64_t>(Traits::capacity(queue_)),
+                       std::memory_order_relaxed);
+    }
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+    BlockingQueue(BlockingQueue&&) = delete;
+    BlockingQueue& operator=(BlockingQueue&&) = delete;
+
+    /** @brief Sentinel returned by the dequeue functions when nothing was dequeued. */
+    static constexpr value_type empty_value() noexcept { return Traits::empty_value(); }
+
+    /**
+     * @brief Non-blocking enqueue.
+     * @return true if enqueued; false if @p value is invalid for the queue or a bounded queue is
+     * full.
+     */
+    bool try_enqueue(value_type value) {
+        if constexpr (kBounded && !Traits::kReportsFull) {
+            if (!acquire_credit()) {
+                return false;
+            }
+            if (!queue_.enqueue(value)) {
+                release_credit();
+                return false;
+            }
+        } else {
+            if (!queue_.enqueue(value)) {
+                return false;
+            }
+        }
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Enqueue, sleeping while the (bounded) queue is full.
+     * @return true once enqueued; false only if @p value is invalid for the queue.
+     */
+    bool enqueue_wait(value_type value) {
+        static_assert(kBounded, "enqueue_wait requires a bounded queue (SCQ or SCQP)");
+        if (value == empty_value()) {
+            return false;
+        }
+        while (true) {
+            if (try_enqueue(value)) {
+                return true;
+            }
+            const auto key = not_full_.prepare_wait();
+            if (try_enqueue(value)) {
+                not_full_.cancel_wait();
+                return true;
+            }
+            not_full_.wait(key);
+        }
+    }
+
+    /**
+     * @brief Non-blocking dequeue.
+     * @return The dequeued value, or @ref empty_value() if the queue is empty.
+     */
+    value_type try_dequeue() {
+        const value_type v = queue_.dequeue();
+        if constexpr (kBounded) {
+            if (v != empty_value()) {
+                if constexpr (!Traits::kReportsFull) {
+                    release_credit();
+                }
+                not_full_.notify_one();
+            }
+        }
+        return v;
+    }
+
+    /** @brief Dequeue, sleeping until a value is available. */
+    value_type dequeue_wait() {
+        while (true) {
+            value_type v = try_dequeue();
+            if (v != empty_value()) {
+                return v;
+            }
+            const auto key = not_empty_.prepare_wait();
+            v = try_dequeue();
+            if (v != empty_value()) {
+                not_empty_.cancel_wait();
+                return v;
+            }
+            not_empty_.wait(key);
+        }
+    }
+
+    /**
+     * @brief Dequeue, sleeping for at most @p timeout.
+     * @return The dequeued value, or @ref empty_value() if the timeout expired first.
+     */
+    template <class Rep, class Period>
+    value_type dequeue_for(const std::chrono::duration<Rep, Period>& timeout) {
+        const auto deadline =
+            std::chrono::steady_clock::now() +
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+        while (true) {
+            value_type v = try_dequeue();
+            if (v != empty_value()) {
+                return v;
+            }
+            const auto key = not_empty_.prepare_wait();
+            v = try_dequeue();
+            if (v != empty_value()) {
+                not_empty_.cancel_wait();
+                return v;
+            }
+            if (!not_empty_.wait_until(key, deadline)) {
+                return try_dequeue();
+            }
+        }
+    }
+
+    /** @brief Access the wrapped queue (bypasses wakeups and capacity accounting). */
+    Queue& queue() noexcept { return queue_; }
+    /** @brief Access the wrapped queue (read-only). */
+    const Queue& queue() const noexcept { return queue_; }
+
+   private:
+    bool acquire_credit() noexcept {
+        std::int64_t c = credits_.load(std::memory_order_relaxed);
+        while (c > 0) {
+            if (credits_.compare_exchange_weak(c, c - 1, std::memory_order_acquire,
+                                               std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void release_credit() noexcept { credits_.fetch_add(1, std::memory_order_release); }
+
+    Queue queue_;
+    detail::EventCount not_empty_;
+    detail::EventCount not_full_;
+    // Free slots (SCQ only).
+    alignas(config::CACHE_LINE_SIZE) std::atomic<std::int64_t> credits_{0};
+};
+
+}  // namespace lscq
+
+#endif  // LSCQ_BLOCKING_QUEUE_HPP_
@@ -0,0 +1,101 @@
+/**
+ * @file cache_remap.hpp
+ * @brief Slot remapping policies for the ring queues (NCQ, SCQ, SCQP).
+ * @author lscq contributors
+ * @version 0.1.0
+ *
+ * Tickets taken from Head/Tail are consecutive, so a ring indexed directly by ticket puts the
+ * slots of concurrent operations next to each other and every enqueue/dequeue pair fights over the
+ * same cache line. The ring queues therefore permute ticket positions before touching the slot
+ * array: with a stride of S, ticket position i goes to slot (i % S) * (N / S) + i / S, so S
+ * consecutive tickets land in S different slices of the ring, N / S slots apart.
+ *
+ * A policy only chooses S for a given slot size:
+ * - IdentityRemap: S = 1, slots in ticket order. Best for bulk consumers that walk runs of
+ *   consecutive tickets and for single-threaded use.
+ * - CacheLineRemap<B>: S = B / sizeof(slot), i.e. one slot per B-byte line for S consecutive
+ *   tickets. DefaultRemap is CacheLineRemap<64>, the original layout.
+ * - AdjacentLineRemap: CacheLineRemap<128>, for CPUs whose adjacent-line prefetcher pulls lines in
+ *   128-byte pairs (most Intel cores), which turns 64-byte spreading into false sharing again.
+ * - StrideRemap<S>: an explicit stride, independent of the slot size.
+ *
+ * A custom policy is any type with a
+ * `static constexpr std::size_t stride(std::size_t slot_bytes) noexcept` returning a power of two.
+ * Queues round their ring up so that it holds at least one slot per slice.
+ *
+ * The library build pre-instantiates DefaultRemap, IdentityRemap and AdjacentLineRemap; any other
+ * policy needs LSCQ_HEADER_ONLY or an include of the queue's lscq/detail/<queue>_impl.hpp.
+ *
+ * Example:
+ * @code
+ * lscq::SCQP<Job, lscq::DefaultWaitPolicy, lscq::AdjacentLineRemap> q(1u << 16);
+ * @endcode
+ */
+
+#ifndef LSCQ_CACHE_REMAP_HPP_
+#define LSCQ_CACHE_REMAP_HPP_
+
+#include <cstddef>
+#include <lscq/detail/ring_math.hpp>
+
+namespace lscq {
+
+/** @brief No remapping: ticket position i uses slot i. */
+struct IdentityRemap {
+    static constexpr std::size_t stride(std::size_t /*slot_bytes*/) noexcept { return 1; }
+};
+
+/**
+ * @brief Spread consecutive tickets so that each one gets its own @p LineBytes-sized line.
+ * @tparam LineBytes Line size in bytes (power of two).
+ */
+template <std::size_t LineBytes>
+struct CacheLineRemap {
+    static_assert(detail::is_power_of_two(LineBytes), "CacheLineRemap: line size must be 2^k");
+
+    static constexpr std::size_t stride(std::size_t slot_bytes) noexcept {
+        return LineBytes > slot_bytes ? LineBytes / slot_bytes : 1;
+    }
+};
+
+/**
+ * @brief Fixed stride, regardless of slot size.
+ * @tparam Stride Number of slices consecutive tickets are spread over (power of two).
+ */
+template <std::size_t Stride>
+struct StrideRemap {
+    static_assert(detail::is_power_of_two(Stride), "StrideRemap: stride must be 2^k");
+
+    static constexpr std::size_t stride(std::size_t /*slot_bytes*/) noexcept { return Stride; }
+};
+
+/** @brief One slot per cache line (the layout of the paper). */
+using DefaultRemap = CacheLineRemap<detail::kCacheLineSize>;
+
+/** @brief One slot per pair of adjacent cache lines. */
+using AdjacentLineRemap = CacheLineRemap<2 * detail::kCacheLineSize>;
+
+namespace detail {
+
+/**
+ * @brief Slot of ticket position @p idx in a ring of @p ring_size slots.
+ *
+ * @p ring_size must be a multiple of @p Stride. A bijection on [0, ring_size).
+ */
+template <std::size_t Stride>
+constexpr std::size_t remap_index(std::size_t idx, std::size_t ring_size) noexcept {
+    static_assert(is_power_of_two(Stride), "remap stride must be 2^k");
+    if constexpr (Stride == 1) {
+        (void)ring_size;
+        return idx;
+    } else {
+        // Stride is a power of two, so the divisions and the modulo compile to shifts and masks.
+        return (idx % Stride) * (ring_size / Stride) + idx / Stride;
+    }
+}
+
+}  // namespace detail
+
+}  // namespace lscq
+
+#endif  // LSCQ_CACHE_REMAP_HPP_
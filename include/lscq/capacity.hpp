@@ -0,0 +1,104 @@
+/**
+ * @file capacity.hpp
+ * @brief Ring capacity policies for SCQ and SCQP: runtime size or compile-time size.
+ * @author lscq contributors
+ * @version 0.1.0
+ *
+ * SCQ and SCQP take their ring size (SCQSIZE = 2n) from a capacity policy:
+ * - DynamicCapacity: SCQSIZE is a constructor argument and the slots live in a separately
+ *   allocated RingStorage (with NUMA / huge-page placement). The default.
+ * - FixedCapacity<N>: SCQSIZE is N. The cycle shift, index mask, threshold reset value and
+ *   cache_remap fold into constants, and the slots live inside the queue object.
+ *
+ * Both run the same algorithm body; only where the size and the slots come from differs.
+ * FixedSCQ and FixedSCQP name the fixed-capacity instantiations.
+ *
+ * Example:
+ * @code
+ * auto q = std::make_unique<lscq::SCQ<std::uint32_t, lscq::DefaultWaitPolicy, lscq::DefaultRemap,
+ *                                     lscq::FixedCapacity<1024>>>();
+ * @endcode
+ */
+
+#ifndef LSCQ_CAPACITY_HPP_
+#define LSCQ_CAPACITY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <lscq/detail/bit.hpp>
+#include <lscq/detail/ring_math.hpp>
+#include <lscq/detail/ring_storage.hpp>
+
+namespace lscq {
+
+/**
+ * @brief Ring size chosen at construction; slots in a placed heap/mmap allocation.
+ *
+ * The queue's derived sizes are plain members, read on every operation.
+ */
+struct DynamicCapacity {
+    /** @brief Slot array type for slots of type @p E. */
+    template <class E>
+    using Ring = detail::RingStorage<E>;
+
+    /** @brief No upper bound on the ring size. */
+    static constexpr std::size_t kMaxScqSize = ~std::size_t{0};
+
+    /** @brief @p requested raised to @p kMinScqSize and rounded up to a power of two. */
+    template <std::size_t kMinScqSize>
+    static constexpr std::size_t ring_size(std::size_t requested) noexcept {
+        return detail::round_up_pow2(requested < kMinScqSize ? kMinScqSize : requested);
+    }
+
+    /** @param scqsize Ring size as returned by @ref ring_size. */
+    explicit DynamicCapacity(std::size_t scqsize) noexcept
+        : scqsize_(scqsize),
+          qsize_(scqsize / 2),
+          bottom_(static_cast<std::uint64_t>(scqsize - 1)),
+          scq_shift_(detail::log2_pow2_u64(static_cast<std::uint64_t>(scqsize))) {}
+
+    std::size_t scqsize_;   // Ring size (2n).
+    std::size_t qsize_;     // Usable capacity (n).
+    std::uint64_t bottom_;  // ⊥ marker and index mask: SCQSIZE - 1.
+    unsigned scq_shift_;    // Cycle of ticket t: t >> scq_shift_.
+};
+
+/**
+ * @brief Ring size fixed at compile time; slots held inline in the queue object.
+ *
+ * The derived sizes carry the same names as DynamicCapacity's members, as static constants, so
+ * the queue bodies read them either way and the compiler folds them.
+ *
+ * @tparam N Ring size (SCQSIZE = 2n). Must be a power of two and at least 4.
+ * @note The queue then holds N slots inline. Allocate large rings on the heap (e.g. with
+ * std::make_unique) rather than on the stack.
+ */
+template <std::size_t N>
+struct FixedCapacity {
+    static_assert(N >= 4 && detail::is_power_of_two(N),
+                  "FixedCapacity<N>: N must be a power of two >= 4");
+
+    template <class E>
+    using Ring = detail::InlineRing<E, N>;
+
+    /** @brief Remap strides are capped at N, so a small ring is spread over all of its slots. */
+    static constexpr std::size_t kMaxScqSize = N;
+
+    /** @brief Always N; the requested size is ignored. */
+    template <std::size_t kMinScqSize>
+    static constexpr std::size_t ring_size(std::size_t /*requested*/) noexcept {
+        static_assert(N >= kMinScqSize, "FixedCapacity<N>: N is below the queue's minimum ring");
+        return N;
+    }
+
+    explicit FixedCapacity(std::size_t /*scqsize*/) noexcept {}
+
+    static constexpr std::size_t scqsize_ = N;
+    static constexpr std::size_t qsize_ = N / 2;
+    static constexpr std::uint64_t bottom_ = N - 1;
+    static constexpr unsigned scq_shift_ = detail::log2_pow2(N);
+};
+
+}  // namespace lscq
+
+#endif  // LSCQ_CAPACITY_HPP_
@@ -8,6 +8,15 @@
  * (two 64-bit words). When the platform supports a native 128-bit CAS instruction, the fast
  * path is used; otherwise the implementation falls back to a striped mutex.
  *
+ * Slot reads go through @ref entry_load_mode: when writers use the native CAS2 the 16-byte value is
+ * read without writing to the cache line (a single SSE load, or a validated two-word load);
+ * otherwise the read takes the same stripe lock as the writers.
+ *
+ * The queues do not call @ref cas2 on their hot paths: they store @ref entry_load_mode at
+ * construction and run their ticket loops through detail::with_cas2_slots, which instantiates each
+ * loop once per mode with the load and CAS resolved at compile time. On x86-64 the native CAS is
+ * inline LOCK CMPXCHG16B, so neither -mcx16 nor libatomic is needed; CPUID gates its use.
+ *
  * Thread-safety: All public functions are thread-safe.
  *
  * Complexity: O(1) expected. The fallback path may block on a mutex under contention.
@@ -26,6 +35,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -38,10 +48,8 @@
 #include <intrin.h>
 #endif
 
-#if defined(__clang__) || defined(__GNUC__)
-#define LSCQ_DETAIL_ATTR_TARGET_CX16 __attribute__((target("cx16")))
-#else
-#define LSCQ_DETAIL_ATTR_TARGET_CX16
+#if LSCQ_ARCH_X86_64
+#include <emmintrin.h>
 #endif
 
 namespace lscq {
@@ -99,12 +107,9 @@ static_assert((kCas2FallbackStripeCount & (kCas2FallbackStripeCount - 1u)) == 0u
 static_assert(kCas2FallbackStripeCount == 16u || kCas2FallbackStripeCount == 32u,
               "LSCQ_CAS2_FALLBACK_STRIPE_COUNT must be 16 or 32");
 
-#if defined(__cpp_lib_hardware_interference_size)
-inline constexpr std::size_t kCas2FallbackCacheLineSize =
-    std::hardware_destructive_interference_size;
-#else
-inline constexpr std::size_t kCas2FallbackCacheLineSize = 64u;
-#endif
+// Same padding unit as the queues (LSCQ_CACHE_LINE), not hardware_destructive_interference_size:
+// the latter follows -mtune and could give the library and its users different layouts.
+inline constexpr std::size_t kCas2FallbackCacheLineSize = config::CACHE_LINE_SIZE;
 
 struct alignas(kCas2FallbackCacheLineSize) Cas2FallbackStripeLock {
     std::mutex mutex;
@@ -130,89 +135,217 @@ inline std::mutex& cas2_fallback_mutex_for(const void* ptr) noexcept {
     return g_cas2_fallback_stripe_locks[cas2_fallback_stripe_index(ptr)].mutex;
 }
 
-inline bool cas2_mutex(Entry* ptr, Entry& expected, const Entry& desired) noexcept {
+// Failure ordering for a CAS with success ordering @p order, as std::atomic derives it.
+constexpr std::memory_order cas_failure_order(std::memory_order order) noexcept {
+    return order == std::memory_order_acq_rel   ? std::memory_order_acquire
+           : order == std::memory_order_release ? std::memory_order_relaxed
+                                                : order;
+}
+
+// CAS2 under the stripe lock, for any 16-byte slot type whose readers and writers share the lock.
+// The mutex orders at least as strongly as acq_rel, so @p order is not needed.
+template <class E>
+inline bool cas2_locked(E* ptr, E& expected, const E& desired,
+                        std::memory_order order = std::memory_order_seq_cst) noexcept {
+    static_assert(sizeof(E) == 16, "slot must be 16 bytes");
+    (void)order;
     std::lock_guard<std::mutex> lock(cas2_fallback_mutex_for(ptr));
-    const Entry current = *ptr;
-    if (current != expected) {
-        expected = current;
+    if (std::memcmp(ptr, &expected, sizeof(E)) != 0) {
+        std::memcpy(&expected, ptr, sizeof(E));
         return false;
     }
-    *ptr = desired;
+    std::memcpy(ptr, &desired, sizeof(E));
     return true;
 }
 
-#if LSCQ_ARCH_X86_64 && LSCQ_PLATFORM_WINDOWS && LSCQ_COMPILER_MSVC
-static_assert(sizeof(long long) == 8, "long long must be 64-bit for CMPXCHG16B intrinsics");
-
-inline long long u64_to_ll(std::uint64_t v) noexcept {
-    long long out = 0;
-    std::memcpy(&out, &v, sizeof(out));
-    return out;
-}
-inline std::uint64_t ll_to_u64(long long v) noexcept {
-    std::uint64_t out = 0;
-    std::memcpy(&out, &v, sizeof(out));
-    return out;
+inline bool cas2_mutex(Entry* ptr, Entry& expected, const Entry& desired) noexcept {
+    return cas2_locked(ptr, expected, desired);
 }
 
-LSCQ_DETAIL_ATTR_TARGET_CX16 inline bool cas2_native(Entry* ptr, Entry& expected,
-                                                     const Entry& desired) noexcept {
-    if (!detail::is_aligned_16(ptr)) {
-        return cas2_mutex(ptr, expected, desired);
-    }
-
+/*
+ * cas2_native_slot(): the 16-byte CAS instruction itself, for any 16-byte slot type (Entry,
+ * SCQP's EntryP). The caller guarantees 16-byte alignment and a CPU that has the instruction
+ * (has_cas2_support()); LSCQ_DETAIL_CAS2_NATIVE says whether this build has one at all.
+ *
+ * @p order only changes the code on AArch64 (CASP/CASPA/CASPL/CASPAL or the matching LDXP/STXP
+ * pair); the x86-64 instruction is LOCK-prefixed and therefore always a full barrier.
+ */
+#if LSCQ_ARCH_X86_64 && LSCQ_PLATFORM_WINDOWS && LSCQ_COMPILER_MSVC
+#define LSCQ_DETAIL_CAS2_NATIVE 1
+
+template <class E>
+inline bool cas2_native_slot(E* ptr, E& expected, const E& desired,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    static_assert(sizeof(E) == 16 && alignof(E) == 16, "slot must be 16 bytes, 16-aligned");
+    static_assert(sizeof(long long) == 8, "long long must be 64-bit for CMPXCHG16B intrinsics");
+    (void)order;
     alignas(16) long long comparand[2];
-    comparand[0] = u64_to_ll(expected.cycle_flags);
-    comparand[1] = u64_to_ll(expected.index_or_ptr);
-
-    const long long exchange_low = u64_to_ll(desired.cycle_flags);
-    const long long exchange_high = u64_to_ll(desired.index_or_ptr);
-
+    long long exchange[2];
+    std::memcpy(comparand, &expected, sizeof(comparand));
+    std::memcpy(exchange, &desired, sizeof(exchange));
     const char ok = _InterlockedCompareExchange128(reinterpret_cast<volatile long long*>(ptr),
-                                                   exchange_high, exchange_low, comparand);
-
-    expected.cycle_flags = ll_to_u64(comparand[0]);
-    expected.index_or_ptr = ll_to_u64(comparand[1]);
+                                                   exchange[1], exchange[0], comparand);
+    std::memcpy(&expected, comparand, sizeof(comparand));
     return ok != 0;
 }
-#elif LSCQ_ARCH_X86_64 && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && \
-    (defined(__GNUC__) || defined(__clang__))
-LSCQ_DETAIL_ATTR_TARGET_CX16 inline bool cas2_native(Entry* ptr, Entry& expected,
-                                                     const Entry& desired) noexcept {
-    if (!detail::is_aligned_16(ptr)) {
-        return cas2_mutex(ptr, expected, desired);
-    }
-
-    Entry expected_local = expected;
-    Entry desired_local = desired;
-    const bool ok = __atomic_compare_exchange(ptr, &expected_local, &desired_local, false,
-                                              __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
-    expected = expected_local;
+#elif LSCQ_ARCH_X86_64 && (defined(__GNUC__) || defined(__clang__))
+#define LSCQ_DETAIL_CAS2_NATIVE 1
+
+// LOCK CMPXCHG16B as inline asm rather than __atomic_compare_exchange: GCC only accepts the
+// builtin with -mcx16 and even then emits a call into libatomic. The assembler takes the
+// instruction without -mcx16; has_cas2_support() is what makes executing it safe.
+template <class E>
+inline bool cas2_native_slot(E* ptr, E& expected, const E& desired,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    static_assert(sizeof(E) == 16 && alignof(E) == 16, "slot must be 16 bytes, 16-aligned");
+    std::uint64_t cmp[2];
+    std::uint64_t xchg[2];
+    std::memcpy(cmp, &expected, sizeof(cmp));
+    std::memcpy(xchg, &desired, sizeof(xchg));
+    (void)order;
+    bool ok;
+#if defined(__GCC_ASM_FLAG_OUTPUTS__)
+    __asm__ __volatile__("lock cmpxchg16b %1"
+                         : "=@ccz"(ok), "+m"(*ptr), "+a"(cmp[0]), "+d"(cmp[1])
+                         : "b"(xchg[0]), "c"(xchg[1])
+                         : "memory");
+#else
+    __asm__ __volatile__("lock cmpxchg16b %1\n\tsetz %0"
+                         : "=q"(ok), "+m"(*ptr), "+a"(cmp[0]), "+d"(cmp[1])
+                         : "b"(xchg[0]), "c"(xchg[1])
+                         : "memory", "cc");
+#endif
+    std::memcpy(&expected, cmp, sizeof(cmp));
     return ok;
 }
 #elif LSCQ_ARCH_ARM64 && (defined(__clang__) || defined(__GNUC__))
-inline bool cas2_native(Entry* ptr, Entry& expected, const Entry& desired) noexcept {
-    if (!detail::is_aligned_16(ptr)) {
-        return cas2_mutex(ptr, expected, desired);
-    }
+#define LSCQ_DETAIL_CAS2_NATIVE 1
 
+template <class E>
+inline bool cas2_native_slot(E* ptr, E& expected, const E& desired,
+                             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    static_assert(sizeof(E) == 16 && alignof(E) == 16, "slot must be 16 bytes, 16-aligned");
     // AArch64:
     // Let the compiler generate optimal code for 16-byte atomics:
     // - Uses CASP when compiled with LSE support (-march=armv8.1-a+lse or higher)
-    // - Falls back to LDAXP/STLXP loop otherwise
-    //
-    // We use seq_cst to match other implementations' semantics.
-    Entry expected_local = expected;
-    Entry desired_local = desired;
+    // - Falls back to an LDXP/STXP loop otherwise
+    // Both take their acquire/release flavour from the orders below.
+    E expected_local = expected;
+    E desired_local = desired;
     const bool ok = __atomic_compare_exchange(ptr, &expected_local, &desired_local, false,
-                                              __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+                                              static_cast<int>(order),
+                                              static_cast<int>(cas_failure_order(order)));
     expected = expected_local;
     return ok;
 }
 #else
-inline bool cas2_native(Entry* ptr, Entry& expected, const Entry& desired) noexcept {
+#define LSCQ_DETAIL_CAS2_NATIVE 0
+#endif
+
+inline bool cas2_native(Entry* ptr, Entry& expected, const Entry& desired,
+                        std::memory_order order = std::memory_order_seq_cst) noexcept {
+#if LSCQ_DETAIL_CAS2_NATIVE
+    if (detail::is_aligned_16(ptr)) {
+        return cas2_native_slot(ptr, expected, desired, order);
+    }
+#else
+    (void)order;
+#endif
     return cas2_mutex(ptr, expected, desired);
 }
+
+// Whether cas2_native() above is a real 16-byte atomic rather than the mutex fallback. The
+// lock-free slot loads below are only correct against writers that update both words at once.
+inline constexpr bool kCas2NativeCompiled = LSCQ_DETAIL_CAS2_NATIVE != 0;
+
+inline std::uint64_t load_u64_acquire(const std::uint64_t* ptr) noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+#elif LSCQ_COMPILER_MSVC
+    // x86-64 loads already have acquire semantics; only compiler reordering must be prevented.
+    const std::uint64_t v = *reinterpret_cast<const volatile std::uint64_t*>(ptr);
+    _ReadWriteBarrier();
+    return v;
+#else
+    return *reinterpret_cast<const volatile std::uint64_t*>(ptr);
+#endif
+}
+
+/**
+ * @brief Read a 16-byte slot under the CAS2 fallback stripe lock.
+ *
+ * Works for any 16-byte slot type (Entry, SCQP's EntryP) whose writers use the same stripe lock.
+ */
+template <class E>
+inline E entry_load_locked(const E* ptr) noexcept {
+    static_assert(sizeof(E) == 16, "slot must be 16 bytes");
+    std::lock_guard<std::mutex> lock(cas2_fallback_mutex_for(ptr));
+    return *ptr;
+}
+
+/**
+ * @brief Read a 16-byte slot as two 64-bit loads validated by re-reading the first word.
+ *
+ * Reads the cycle word, the payload word, then the cycle word again and retries until both cycle
+ * reads agree. This yields a value the slot actually held as long as (a) every writer updates the
+ * slot with a 16-byte atomic or an 8-byte atomic on the payload word, and (b) the first word never
+ * returns to a value it held before, which holds for the monotonically increasing cycle field of
+ * the NCQ/SCQ/SCQP slot encodings.
+ *
+ * The first two loads must be acquire for the validation itself (the payload load may not be
+ * satisfied before the first cycle load, nor the re-read before the payload load), so slot reads
+ * are acquire on every path and take no memory-order argument: there is nothing weaker to offer.
+ */
+template <class E>
+inline E entry_load_two_word(const E* ptr) noexcept {
+    static_assert(sizeof(E) == 16, "slot must be 16 bytes");
+    const auto* words = reinterpret_cast<const std::uint64_t*>(ptr);
+    std::uint64_t out[2];
+    std::uint64_t first = load_u64_acquire(&words[0]);
+    while (true) {
+        out[1] = load_u64_acquire(&words[1]);
+        out[0] = load_u64_acquire(&words[0]);
+        if (out[0] == first) {
+            break;
+        }
+        first = out[0];
+    }
+    E result;
+    std::memcpy(&result, out, sizeof(result));
+    return result;
+}
+
+#if LSCQ_ARCH_X86_64
+/**
+ * @brief Read a 16-byte slot with one aligned SSE load.
+ *
+ * Intel and AMD document 16-byte aligned SSE/AVX loads as atomic on processors that enumerate
+ * AVX (see @ref cpu_has_avx), so the caller must check that before using this path.
+ */
+template <class E>
+inline E entry_load_vector(const E* ptr) noexcept {
+    static_assert(sizeof(E) == 16, "slot must be 16 bytes");
+#if defined(__GNUC__) || defined(__clang__)
+    // Through asm: GCC lowers _mm_load_si128 followed by a memcpy out of the register into two
+    // 8-byte loads, which tear against a concurrent CMPXCHG16B.
+    __m128i v;
+#if defined(__AVX__)
+    __asm__ __volatile__("vmovdqa %1, %0"  // VEX form: no SSE/AVX transition stalls.
+#else
+    __asm__ __volatile__("movdqa %1, %0"
+#endif
+                         : "=x"(v)
+                         : "m"(*reinterpret_cast<const __m128i*>(ptr))
+                         : "memory");
+#else
+    const __m128i v = _mm_load_si128(reinterpret_cast<const __m128i*>(ptr));
+#endif
+    // x86 loads are not reordered with later loads; keep the compiler from doing so either.
+    std::atomic_signal_fence(std::memory_order_acquire);
+    E result;
+    std::memcpy(&result, &v, sizeof(result));
+    return result;
+}
 #endif
 
 }  // namespace detail
@@ -227,7 +360,7 @@ inline bool cas2_native(Entry* ptr, Entry& expected, const Entry& desired) noexc
  * @note This function is safe to call from hot paths; the capability result is cached.
  */
 inline bool has_cas2_support() noexcept {
-#if !LSCQ_ENABLE_CAS2
+#if !LSCQ_ENABLE_CAS2 || !LSCQ_DETAIL_CAS2_NATIVE
     return false;
 #elif LSCQ_ARCH_X86_64
     // Avoid executing CMPXCHG16B on CPUs that don't support it.
@@ -236,7 +369,7 @@ inline bool has_cas2_support() noexcept {
     // repeated CPUID overhead.
     static const bool supported = detail::cpu_has_cmpxchg16b();
     return supported;
-#elif LSCQ_ARCH_ARM64 && (defined(__clang__) || defined(__GNUC__))
+#elif LSCQ_ARCH_ARM64
     // AArch64 always supports an atomic 16-byte CAS via LDAXP/STLXP loop, and may use CASP when
     // compiling for an LSE-enabled target.
     return true;
@@ -245,6 +378,141 @@ inline bool has_cas2_support() noexcept {
 #endif
 }
 
+/**
+ * @brief How queue slots are read (see @ref entry_load_mode).
+ */
+enum class EntryLoadMode {
+    /** @brief Copy the slot under the CAS2 fallback stripe lock (writers use the mutex). */
+    kLocked,
+    /** @brief Two 64-bit loads validated by re-reading the cycle word. */
+    kTwoWord,
+    /** @brief One 16-byte aligned SSE load (x86-64 with AVX). */
+    kVector,
+};
+
+/**
+ * @brief Select the slot read path for this process.
+ *
+ * Reads must match the writers: if CAS2 goes through the striped mutex the read takes the lock
+ * too, otherwise the slot is read without writing to its cache line. The choice is made once
+ * (CPUID) and cached.
+ *
+ * @return @ref EntryLoadMode::kLocked unless native CAS2 is compiled in and supported;
+ *         @ref EntryLoadMode::kVector on x86-64 CPUs with AVX; @ref EntryLoadMode::kTwoWord
+ *         otherwise.
+ */
+inline EntryLoadMode entry_load_mode() noexcept {
+#if !LSCQ_ENABLE_CAS2
+    return EntryLoadMode::kLocked;
+#else
+    static const EntryLoadMode mode = [] {
+        if (!detail::kCas2NativeCompiled || !has_cas2_support()) {
+            return EntryLoadMode::kLocked;
+        }
+#if LSCQ_ARCH_X86_64 && !defined(__SANITIZE_THREAD__)
+        if (detail::cpu_has_avx()) {
+            return EntryLoadMode::kVector;
+        }
+#endif
+        return EntryLoadMode::kTwoWord;
+    }();
+    return mode;
+#endif
+}
+
+namespace detail {
+
+/**
+ * @brief Read a 16-byte slot using the path chosen by @ref entry_load_mode.
+ *
+ * Unlike a no-op CAS2, the lock-free paths never take the line exclusive, so concurrent readers of
+ * the same slot do not invalidate each other.
+ */
+template <class E>
+inline E entry_load_dispatch(const E* ptr) noexcept {
+    switch (entry_load_mode()) {
+#if LSCQ_ARCH_X86_64
+        case EntryLoadMode::kVector:
+            return entry_load_vector(ptr);
+#endif
+        case EntryLoadMode::kTwoWord:
+            return entry_load_two_word(ptr);
+        default:
+            return entry_load_locked(ptr);
+    }
+}
+
+// Atomic read of a 16-byte Entry that does not write to the slot (see lscq::entry_load_mode()).
+inline Entry entry_load(const Entry* ptr) noexcept { return entry_load_dispatch(ptr); }
+
+/**
+ * @brief Slot load and CAS2 for one @ref EntryLoadMode, resolved at compile time.
+ *
+ * The queues take one of these as a tag and instantiate their ticket loops once per mode, so the
+ * hot path carries neither the capability check of @ref lscq::cas2 nor the switch of
+ * @ref entry_load_dispatch, and the native modes inline the CAS instruction. Slots must be
+ * 16-byte aligned (the queues' ring storage is).
+ */
+template <EntryLoadMode Mode>
+struct Cas2Slots {
+    static constexpr EntryLoadMode kMode = Mode;
+
+    template <class E>
+    static E load(const E* ptr) noexcept {
+        if constexpr (Mode == EntryLoadMode::kLocked) {
+            return entry_load_locked(ptr);
+#if LSCQ_ARCH_X86_64
+        } else if constexpr (Mode == EntryLoadMode::kVector) {
+            return entry_load_vector(ptr);
+#endif
+        } else {
+            return entry_load_two_word(ptr);
+        }
+    }
+
+    template <class E>
+    static bool cas(E* ptr, E& expected, const E& desired,
+                    std::memory_order order = std::memory_order_seq_cst) noexcept {
+        if constexpr (Mode == EntryLoadMode::kLocked) {
+            return cas2_locked(ptr, expected, desired, order);
+        } else {
+#if LSCQ_DETAIL_CAS2_NATIVE
+            return cas2_native_slot(ptr, expected, desired, order);
+#else
+            static_assert(sizeof(E) == 0, "lock-free slot modes need a native CAS2");
+            return false;
+#endif
+        }
+    }
+};
+
+/**
+ * @brief Call @p f with the @ref Cas2Slots tag for @p mode and return its result.
+ *
+ * Only the modes this build can select are instantiated. Queues store @ref entry_load_mode() at
+ * construction and branch here once per public operation, not once per slot access.
+ */
+template <class F>
+inline decltype(auto) with_cas2_slots(EntryLoadMode mode, F&& f) {
+#if LSCQ_ENABLE_CAS2 && LSCQ_DETAIL_CAS2_NATIVE
+    switch (mode) {
+#if LSCQ_ARCH_X86_64
+        case EntryLoadMode::kVector:
+            return f(Cas2Slots<EntryLoadMode::kVector>{});
+#endif
+        case EntryLoadMode::kTwoWord:
+            return f(Cas2Slots<EntryLoadMode::kTwoWord>{});
+        default:
+            break;
+    }
+#else
+    (void)mode;
+#endif
+    return f(Cas2Slots<EntryLoadMode::kLocked>{});
+}
+
+}  // namespace detail
+
 /**
  * @brief Atomically compare-and-swap a 16-byte @ref Entry.
  *
@@ -254,6 +522,8 @@ inline bool has_cas2_support() noexcept {
  * @param ptr Pointer to the @ref Entry to update.
  * @param[in,out] expected Expected old value; updated with the observed value on failure.
  * @param desired Desired new value.
+ * @param order Ordering of a successful swap; a failed one uses the same order minus its release
+ *        part, as for std::atomic. Only AArch64 emits weaker code for weaker orders.
  * @return true if the swap succeeded; false otherwise.
  *
  * @note If @p ptr is null, this function returns false and leaves @p expected unchanged.
@@ -263,19 +533,18 @@ inline bool has_cas2_support() noexcept {
  *
  * Complexity: O(1) expected.
  */
-inline bool cas2(Entry* ptr, Entry& expected, const Entry& desired) noexcept {
+inline bool cas2(Entry* ptr, Entry& expected, const Entry& desired,
+                 std::memory_order order = std::memory_order_seq_cst) noexcept {
     if (ptr == nullptr) {
         return false;
     }
 
 #if LSCQ_ENABLE_CAS2
     if (has_cas2_support()) {
-        return detail::cas2_native(ptr, expected, desired);
+        return detail::cas2_native(ptr, expected, desired, order);
     }
 #endif
-    return detail::cas2_mutex(ptr, expected, desired);
+    return detail::cas2_locked(ptr, expected, desired, order);
 }
 
 }  // namespace lscq
-
-#undef LSCQ_DETAIL_ATTR_TARGET_CX16
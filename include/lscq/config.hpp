@@ -28,6 +28,44 @@
 #define LSCQ_ENABLE_CAS2 0
 #endif
 
+/** @def LSCQ_HEADER_ONLY
+ * @brief Build-time toggle for the header-only mode of the queue templates.
+ *
+ * When 0 (default), NCQ, SCQ, SCQ64, SCQP, LSCQ and MSQueue are declared `extern template` for
+ * their uint32_t/uint64_t instantiations and the definitions come from the lscq_impl library.
+ * When 1, the public headers also include the definitions (lscq/detail/<queue>_impl.hpp), so the
+ * queues can be instantiated for any value type and their hot paths inlined into the caller. Link
+ * the lscq::header_only CMake target to get this mode.
+ */
+#ifndef LSCQ_HEADER_ONLY
+#define LSCQ_HEADER_ONLY 0
+#endif
+
+/** @def LSCQ_HAS_NUMA
+ * @brief Build-time toggle for libnuma-backed memory placement.
+ *
+ * Provided by CMake (1 when LSCQ_ENABLE_NUMA is ON and both numa.h and libnuma were found, in which
+ * case lscq::lscq also links libnuma). When 0, NUMA placement requests fall back to regular heap
+ * allocations. It is deliberately not derived from `__has_include(<numa.h>)`: the header alone
+ * does not mean the program links against libnuma.
+ */
+#ifndef LSCQ_HAS_NUMA
+#define LSCQ_HAS_NUMA 0
+#endif
+
+/** @def LSCQ_CACHE_LINE
+ * @brief Destructive interference size in bytes: the unit for all padding and ring alignment.
+ *
+ * Provided by CMake (the LSCQ_CACHE_LINE cache variable, default 64). Head/Tail/threshold, LSCQ
+ * node links, the EBR/pool/blocking-queue counters and the CAS2 fallback stripe locks are each
+ * aligned to it, rings are allocated on it, and DefaultRemap spreads tickets one per line of this
+ * size. Use 128 on cores with 128-byte lines (Apple-derived ARM) or an adjacent-line prefetcher
+ * (most Intel server parts). It changes object layouts, so all code linked together must agree.
+ */
+#ifndef LSCQ_CACHE_LINE
+#define LSCQ_CACHE_LINE 64
+#endif
+
 /** @def LSCQ_ENABLE_SANITIZERS
  * @brief Build-time toggle indicating sanitizer instrumentation is enabled.
  *
@@ -141,6 +179,14 @@ namespace config {
  */
 inline constexpr std::size_t DEFAULT_SCQSIZE = 65536;
 
+/**
+ * @brief First-node size (in slots) of an LSCQ built with `LSCQNodeSizing::growing()`.
+ *
+ * @note Small enough that an idle queue costs a few hundred bytes of ring; later nodes double up
+ * to the configured cap when the queue actually fills.
+ */
+inline constexpr std::size_t LSCQ_SMALL_SCQSIZE = 16;
+
 /**
  * @brief Default capacity (in slots) for generic queue-like components.
  *
@@ -149,6 +195,16 @@ inline constexpr std::size_t DEFAULT_SCQSIZE = 65536;
  */
 inline constexpr std::size_t DEFAULT_QSIZE = 32768;
 
+/**
+ * @brief Alignment of padded shared members and ring storage, from @ref LSCQ_CACHE_LINE.
+ *
+ * @note Prefer this over `std::hardware_destructive_interference_size`, whose value depends on the
+ * compiler's tuning flags and so can differ between the library and its users.
+ */
+inline constexpr std::size_t CACHE_LINE_SIZE = LSCQ_CACHE_LINE;
+static_assert(CACHE_LINE_SIZE >= 64 && (CACHE_LINE_SIZE & (CACHE_LINE_SIZE - 1)) == 0,
+              "LSCQ_CACHE_LINE must be a power of two >= 64");
+
 }  // namespace config
 
 }  // namespace lscq
@@ -37,6 +37,23 @@ inline T* atomic_exchange_ptr(T** ptr, T* desired) noexcept {
 #endif
 }
 
+template <class T>
+inline void atomic_store_ptr(T** ptr, T* desired) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+
+#if defined(__clang__) || defined(__GNUC__)
+    __atomic_store_n(ptr, desired, __ATOMIC_RELEASE);
+#elif LSCQ_COMPILER_MSVC
+    static_assert(sizeof(T*) == sizeof(void*));
+    (void)_InterlockedExchangePointer(reinterpret_cast<void* volatile*>(ptr),
+                                      reinterpret_cast<void*>(desired));
+#else
+    __atomic_store(ptr, &desired, __ATOMIC_RELEASE);
+#endif
+}
+
 template <class T>
 inline bool atomic_compare_exchange_ptr(T** ptr, T*& expected, T* desired) noexcept {
     if (ptr == nullptr) {
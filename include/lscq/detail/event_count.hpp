@@ -0,0 +1,153 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <lscq/config.hpp>
+
+#if LSCQ_PLATFORM_LINUX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <cerrno>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace lscq::detail {
+
+/**
+ * @brief Eventcount: lets a thread sleep until "something changed" without losing wakeups.
+ *
+ * Usage (waiter):
+ * @code
+ * while (!try_consume()) {
+ *     const auto key = ec.prepare_wait();
+ *     if (try_consume()) { ec.cancel_wait(); break; }
+ *     ec.wait(key);
+ * }
+ * @endcode
+ *
+ * Usage (notifier): publish the state change, then call @ref notify_one / @ref notify_all.
+ *
+ * The notifier only pays a fence and one load while nobody is registered; the epoch bump and the
+ * futex wake syscall happen only when at least one waiter announced itself in @ref prepare_wait.
+ * On Linux the waiter sleeps on the 32-bit epoch word with FUTEX_WAIT_PRIVATE; elsewhere a
+ * mutex/condition_variable pair provides the same contract.
+ */
+class EventCount {
+   public:
+    using Key = std::uint32_t;
+
+    EventCount() noexcept = default;
+    EventCount(const EventCount&) = delete;
+    EventCount& operator=(const EventCount&) = delete;
+
+    /** @brief Register as a waiter and snapshot the epoch. Must be followed by wait/cancel_wait. */
+    Key prepare_wait() noexcept {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        return epoch_.load(std::memory_order_seq_cst);
+    }
+
+    /** @brief Deregister after the re-check succeeded. */
+    void cancel_wait() noexcept { waiters_.fetch_sub(1, std::memory_order_seq_cst); }
+
+    /** @brief Sleep until the epoch moves past @p key (spurious wakeups are possible). */
+    void wait(Key key) noexcept {
+        while (epoch_.load(std::memory_order_acquire) == key) {
+            (void)sleep_until_changed(key, nullptr);
+        }
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief Like @ref wait, but gives up at @p deadline.
+     * @return false if the deadline passed before the epoch moved.
+     */
+    bool wait_until(Key key, std::chrono::steady_clock::time_point deadline) noexcept {
+        bool changed = true;
+        while (epoch_.load(std::memory_order_acquire) == key) {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                changed = false;
+                break;
+            }
+            const auto remaining = deadline - now;
+            (void)sleep_until_changed(key, &remaining);
+        }
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+        return changed;
+    }
+
+    /** @brief Wake one waiter, if any. No syscall when nobody is waiting. */
+    void notify_one() noexcept { notify(false); }
+
+    /** @brief Wake all waiters, if any. No syscall when nobody is waiting. */
+    void notify_all() noexcept { notify(true); }
+
+    /** @brief Approximate number of registered waiters (diagnostics/tests). */
+    std::uint32_t waiters() const noexcept { return waiters_.load(std::memory_order_relaxed); }
+
+   private:
+    void notify(bool all) noexcept {
+        // Pairs with the seq_cst increment in prepare_wait(): either the waiter's re-check sees the
+        // notifier's state change, or this load sees the waiter.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+        epoch_.fetch_add(1, std::memory_order_seq_cst);
+#if LSCQ_PLATFORM_LINUX
+        (void)syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&epoch_), FUTEX_WAKE_PRIVATE,
+                      all ? INT32_MAX : 1, nullptr, nullptr, 0);
+#else
+        {
+            // Taking the lock orders the epoch bump with a waiter between its check and its wait.
+            std::lock_guard<std::mutex> lock(mutex_);
+        }
+        if (all) {
+            cv_.notify_all();
+        } else {
+            cv_.notify_one();
+        }
+#endif
+    }
+
+    bool sleep_until_changed(Key key, const std::chrono::steady_clock::duration* timeout) noexcept {
+#if LSCQ_PLATFORM_LINUX
+        static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+                      "futex word must be a plain 32-bit integer");
+        struct timespec ts;
+        struct timespec* ts_ptr = nullptr;
+        if (timeout != nullptr) {
+            const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(*timeout).count();
+            ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+            ts.tv_nsec = static_cast<long>(ns % 1000000000);
+            ts_ptr = &ts;
+        }
+        const long rc = syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&epoch_),
+                                FUTEX_WAIT_PRIVATE, key, ts_ptr, nullptr, 0);
+        return rc == 0 || errno != ETIMEDOUT;
+#else
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (timeout == nullptr) {
+            cv_.wait(lock, [&] { return epoch_.load(std::memory_order_acquire) != key; });
+            return true;
+        }
+        return cv_.wait_for(lock, *timeout,
+                            [&] { return epoch_.load(std::memory_order_acquire) != key; });
+#endif
+    }
+
+    std::atomic<std::uint32_t> epoch_{0};
+    std::atomic<std::uint32_t> waiters_{0};
+#if !LSCQ_PLATFORM_LINUX
+    std::mutex mutex_;
+    std::condition_variable cv_;
+#endif
+};
+
+}  // namespace lscq::detail
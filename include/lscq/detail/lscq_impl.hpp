@@ -0,0 +1,645 @@
+#pragma once
+
+#include <algorithm>
+#include <lscq/detail/bit.hpp>
+#include <lscq/detail/ring_math.hpp>
+#include <lscq/lscq.hpp>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace lscq {
+
+namespace detail {
+
+// Increment/closing_ check against the destructor's closing_ store/counter load is a
+// store-buffering (Dekker) handshake: acquire/release alone lets both sides miss each other, so
+// the four accesses involved are seq_cst. Leaving only has to publish the operation's effects.
+class ActiveOpsGuard {
+   public:
+    explicit ActiveOpsGuard(std::atomic<int>& counter) noexcept : counter_(counter) {
+        counter_.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    ~ActiveOpsGuard() noexcept { counter_.fetch_sub(1, std::memory_order_release); }
+
+    const std::atomic<int>& counter() const noexcept { return counter_; }
+
+    ActiveOpsGuard(const ActiveOpsGuard&) = delete;
+    ActiveOpsGuard& operator=(const ActiveOpsGuard&) = delete;
+    ActiveOpsGuard(ActiveOpsGuard&&) = delete;
+    ActiveOpsGuard& operator=(ActiveOpsGuard&&) = delete;
+
+   private:
+    std::atomic<int>& counter_;
+};
+
+template <class Node>
+inline void prepare_node_for_use(Node* node, std::size_t scqsize, RingPlacement placement) {
+    using Ring = decltype(Node::scqp);
+    if (node == nullptr) {
+        return;
+    }
+
+    node->next.store(nullptr, std::memory_order_relaxed);
+    node->staged.store(nullptr, std::memory_order_relaxed);
+
+    if (!node->scqp.reset_for_reuse()) {
+        node->scqp.~Ring();
+        new (&node->scqp) Ring(scqsize, placement);
+    }
+}
+
+// Ring size SCQP actually allocates for a requested `scqsize`.
+template <class T, class WaitPolicy>
+inline std::size_t lscq_node_scqsize(std::size_t scqsize) noexcept {
+    constexpr std::size_t kMinScqsize = std::max<std::size_t>(4, SCQP<T, WaitPolicy>::kRemapStride);
+    return round_up_pow2(std::max(scqsize, kMinScqsize));
+}
+
+}  // namespace detail
+
+// ============================================================================
+// Node Implementation
+// ============================================================================
+
+template <class T, class WaitPolicy, class PoolPolicy>
+LSCQ<T, WaitPolicy, PoolPolicy>::Node::Node(std::size_t scqsize, RingPlacement placement)
+    : scqp(scqsize, placement),
+      next(nullptr),
+      limbo_next(nullptr),
+      retire_epoch(0),
+      staged(nullptr),
+      stage_at(0) {}
+
+// ============================================================================
+// NodePool Implementation
+// ============================================================================
+
+template <class T, class WaitPolicy, class PoolPolicy>
+LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::NodePool(LSCQNodeSizing sizing,
+                                                    RingPlacement placement,
+                                                    std::size_t shard_count)
+    : sizing_(), placement_(placement), shard_count_(shard_count), class_count_(0), classes_() {
+    sizing_.initial_scqsize = detail::lscq_node_scqsize<T, WaitPolicy>(sizing.initial_scqsize);
+    sizing_.max_scqsize = std::max(sizing_.initial_scqsize,
+                                   detail::lscq_node_scqsize<T, WaitPolicy>(sizing.max_scqsize));
+    sizing_.stage_successor_at_percent = std::min(sizing.stage_successor_at_percent, 100u);
+    if (shard_count_ == 0) {
+        shard_count_ = detail::ObjectPoolCore<Node>::DefaultShardCount();
+    }
+    class_count_ = detail::log2_pow2_u64(sizing_.max_scqsize) -
+                   detail::log2_pow2_u64(sizing_.initial_scqsize) + 1;
+    classes_ = std::make_unique<std::atomic<ClassPool*>[]>(class_count_);
+    for (std::size_t c = 0; c < class_count_; ++c) {
+        classes_[c].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::~NodePool() {
+    for (std::size_t c = 0; c < class_count_; ++c) {
+        delete classes_[c].load(std::memory_order_acquire);
+    }
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+std::size_t LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::class_of(
+    std::size_t scqsize) const noexcept {
+    if (scqsize < sizing_.initial_scqsize || scqsize > sizing_.max_scqsize ||
+        !detail::is_power_of_two(scqsize)) {
+        return class_count_;
+    }
+    return detail::log2_pow2_u64(scqsize) - detail::log2_pow2_u64(sizing_.initial_scqsize);
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+typename LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::ClassPool&
+LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::class_pool(std::size_t size_class) {
+    std::atomic<ClassPool*>& slot = classes_[size_class];
+    ClassPool* pool = slot.load(std::memory_order_acquire);
+    if (pool != nullptr) {
+        return *pool;
+    }
+
+    // The factory runs on the thread that calls Get(), i.e. the one linking the node, so
+    // RingPlacement::local() places each new ring next to its first producer.
+    const std::size_t scqsize = sizing_.initial_scqsize << size_class;
+    const RingPlacement placement = placement_;
+    auto created = std::make_unique<ClassPool>(
+        [scqsize, placement] { return new Node(scqsize, placement); }, shard_count_);
+    if (slot.compare_exchange_strong(pool, created.get(), std::memory_order_acq_rel,
+                                     std::memory_order_acquire)) {
+        return *created.release();
+    }
+    return *pool;  // Another thread installed one first.
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+typename LSCQ<T, WaitPolicy, PoolPolicy>::Node* LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::Get(
+    std::size_t scqsize) {
+    scqsize = detail::lscq_node_scqsize<T, WaitPolicy>(scqsize);
+    const std::size_t size_class = class_of(scqsize);
+    Node* node = nullptr;
+    if (size_class != class_count_) {
+        // Only a class that ever had a node returned has a pool to look in.
+        if (ClassPool* pool = classes_[size_class].load(std::memory_order_acquire)) {
+            node = pool->Get();
+            detail::prepare_node_for_use(node, scqsize, placement_);
+        }
+    }
+    if (node == nullptr) {
+        node = new Node(scqsize, placement_);
+    }
+
+    const std::size_t percent = sizing_.stage_successor_at_percent;
+    node->stage_at = (percent == 0) ? 0 : std::max<std::size_t>(1, scqsize * percent / 100);
+    return node;
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+void LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::Put(Node* node) {
+    if (node == nullptr) {
+        return;
+    }
+    const std::size_t size_class = class_of(node->scqp.scqsize());
+    if (size_class == class_count_) {
+        delete node;
+        return;
+    }
+    class_pool(size_class).Put(node);
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+void LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::PutBatch(Node** nodes, std::size_t count) {
+    // Hand over runs of same-size nodes; with a fixed sizing that is the whole batch.
+    std::size_t begin = 0;
+    while (begin < count) {
+        const std::size_t size_class = class_of(nodes[begin]->scqp.scqsize());
+        std::size_t end = begin + 1;
+        while (end < count && class_of(nodes[end]->scqp.scqsize()) == size_class) {
+            ++end;
+        }
+        if (size_class == class_count_) {
+            for (std::size_t i = begin; i < end; ++i) {
+                delete nodes[i];
+            }
+        } else if constexpr (detail::has_put_batch<ClassPool>::value) {
+            class_pool(size_class).PutBatch(nodes + begin, end - begin);
+        } else {
+            ClassPool& pool = class_pool(size_class);
+            for (std::size_t i = begin; i < end; ++i) {
+                pool.Put(nodes[i]);
+            }
+        }
+        begin = end;
+    }
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+void LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::Clear() {
+    for (std::size_t c = 0; c < class_count_; ++c) {
+        if (ClassPool* pool = classes_[c].load(std::memory_order_acquire)) {
+            pool->Clear();
+        }
+    }
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+std::size_t LSCQ<T, WaitPolicy, PoolPolicy>::NodePool::Size() const {
+    std::size_t total = 0;
+    for (std::size_t c = 0; c < class_count_; ++c) {
+        if (const ClassPool* pool = classes_[c].load(std::memory_order_acquire)) {
+            total += pool->Size();
+        }
+    }
+    return total;
+}
+
+// ============================================================================
+// LSCQ Implementation
+// ============================================================================
+
+template <class T, class WaitPolicy, class PoolPolicy>
+LSCQ<T, WaitPolicy, PoolPolicy>::LSCQ(std::size_t scqsize, RingPlacement placement)
+    : LSCQ(LSCQNodeSizing::fixed(scqsize), placement) {}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+LSCQ<T, WaitPolicy, PoolPolicy>::LSCQ(LSCQNodeSizing sizing, RingPlacement placement)
+    : LSCQ(std::make_shared<NodePool>(
+          sizing, placement, sizing.initial_scqsize < sizing.max_scqsize ? 1 : 0)) {}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+LSCQ<T, WaitPolicy, PoolPolicy>::LSCQ(std::shared_ptr<NodePool> pool)
+    : head_(nullptr), tail_(nullptr), pool_(std::move(pool)), legacy_ebr_(nullptr) {
+    // Create the initial node
+    Node* initial = pool_->Get(pool_->sizing().initial_scqsize);
+    head_.store(initial, std::memory_order_relaxed);
+    tail_.store(initial, std::memory_order_relaxed);
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+LSCQ<T, WaitPolicy, PoolPolicy>::LSCQ(EBRManager& ebr, std::size_t scqsize) : LSCQ(scqsize) {
+    legacy_ebr_ = &ebr;
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+LSCQ<T, WaitPolicy, PoolPolicy>::~LSCQ() {
+    // seq_cst pairs with ActiveOpsGuard's increment and the operations' closing_ check.
+    closing_.store(true, std::memory_order_seq_cst);
+
+    // An operation counted before the store above stays visible on its shard until it leaves;
+    // one counted later sees closing_ and leaves without touching a node. So each counter only
+    // has to be seen at zero once, not all of them at the same instant.
+    WaitPolicy backoff;
+    for (ActiveOpsShard& shard : active_ops_) {
+        for (std::atomic<int>& count : shard.count) {
+            while (count.load(std::memory_order_seq_cst) > 0) {
+                backoff.wait();
+            }
+        }
+    }
+
+    // Return all nodes in the linked list (with a successor still staged on the tail node) and
+    // those waiting in limbo to the pool. A private pool deletes them when pool_ is released; a
+    // shared one keeps them for its other queues.
+    Node* current = head_.load(std::memory_order_relaxed);
+    while (current != nullptr) {
+        Node* next = current->next.load(std::memory_order_relaxed);
+        Node* staged = current->staged.load(std::memory_order_acquire);
+        if (is_staged_node(staged)) {
+            pool_->Put(staged);
+        }
+        pool_->Put(current);
+        current = next;
+    }
+    for (ActiveOpsShard& shard : active_ops_) {
+        current = shard.limbo.exchange(nullptr, std::memory_order_acquire);
+        while (current != nullptr) {
+            Node* next = current->limbo_next;
+            pool_->Put(current);
+            current = next;
+        }
+    }
+
+    head_.store(nullptr, std::memory_order_relaxed);
+    tail_.store(nullptr, std::memory_order_relaxed);
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+bool LSCQ<T, WaitPolicy, PoolPolicy>::enqueue(T* ptr) {
+    if (ptr == nullptr) {
+        return false;
+    }
+
+    detail::ActiveOpsGuard active_guard(enter_epoch());
+
+    // Checked only after publishing to the shard, which closes the destructor race window.
+    if (closing_.load(std::memory_order_seq_cst)) {
+        return false;
+    }
+
+    while (true) {
+        // seq_cst (a plain load on x86 and AArch64) orders it after enter_epoch()'s increment.
+        Node* tail = tail_.load(std::memory_order_seq_cst);
+
+        // 1. Try the tail node's SCQP. It fails fast once the node is full or finalized.
+        if (tail->scqp.enqueue(ptr)) {
+            stage_successor_if_due(tail);
+            return true;
+        }
+
+        // 2. Help swing tail_ past a node that has already been extended.
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr) {
+            tail_.compare_exchange_strong(tail, next, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed);
+            continue;
+        }
+
+        // 3. Link a successor holding ptr; on a lost race retry on the winner's node.
+        if (extend_tail(tail, &ptr, 1) != 0) {
+            return true;
+        }
+    }
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+std::size_t LSCQ<T, WaitPolicy, PoolPolicy>::extend_tail(Node* tail, T* const* ptrs,
+                                                         std::size_t count) {
+    // 1. Close the node: producers that take a ticket from now on fail and move to the successor,
+    // so once next is visible no enqueue can land here any more.
+    tail->scqp.finalize();
+
+    // 2. Fill a fresh node before publishing it, so that linking it also completes our enqueue.
+    // Each successor doubles the ring up to the cap: a queue that keeps filling its tail node
+    // soon runs on full-size nodes, while one that never does stays small. Take the staged
+    // successor if there is one; claiming the slot also keeps anyone from staging one later.
+    Node* new_node = tail->staged.exchange(consumed_marker(), std::memory_order_acquire);
+    if (!is_staged_node(new_node)) {
+        new_node = pool_->Get(successor_scqsize(tail));
+    }
+    const std::size_t carried = new_node->scqp.enqueue_bulk(ptrs, count);
+
+    // 3. Link it and swing tail_.
+    Node* expected_next = nullptr;
+    if (tail->next.compare_exchange_strong(expected_next, new_node, std::memory_order_acq_rel,
+                                           std::memory_order_acquire)) {
+        tail_.compare_exchange_strong(tail, new_node, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed);
+        return carried;
+    }
+
+    // 4. Another thread linked first: take the pointers back out and recycle the node. Nobody
+    // else has seen it, so it needs no grace period.
+    while (new_node->scqp.dequeue() != nullptr) {
+    }
+    pool_->Put(new_node);
+    return 0;
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+bool LSCQ<T, WaitPolicy, PoolPolicy>::stage_successor() {
+    detail::ActiveOpsGuard active_guard(enter_epoch());
+
+    // Checked only after publishing to the shard, which closes the destructor race window.
+    if (closing_.load(std::memory_order_seq_cst)) {
+        return false;
+    }
+
+    // A lagging tail_ points at a node that is already extended, which try_stage_successor sees.
+    return try_stage_successor(tail_.load(std::memory_order_seq_cst));
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+bool LSCQ<T, WaitPolicy, PoolPolicy>::try_stage_successor(Node* tail) {
+    // Reserve the slot first, so that only one thread allocates a successor for the node.
+    Node* expected = nullptr;
+    if (!tail->staged.compare_exchange_strong(expected, staging_marker(),
+                                              std::memory_order_relaxed,
+                                              std::memory_order_relaxed)) {
+        return false;
+    }
+
+    // If this throws, the marker stays and the node's extension allocates as usual.
+    Node* successor = pool_->Get(successor_scqsize(tail));
+    expected = staging_marker();
+    if (tail->staged.compare_exchange_strong(expected, successor, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+        return true;
+    }
+
+    // The node filled up meanwhile and was extended without it. Nobody has seen the successor.
+    pool_->Put(successor);
+    return false;
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+void LSCQ<T, WaitPolicy, PoolPolicy>::stage_successor_if_due(Node* tail) noexcept {
+    if (tail->stage_at == 0 || tail->staged.load(std::memory_order_relaxed) != nullptr ||
+        tail->scqp.size_approx() < tail->stage_at) {
+        return;
+    }
+    // The element is already in the queue, so a failed speculative allocation must not surface
+    // from enqueue; the extension retries it if the node actually fills.
+    try {
+        try_stage_successor(tail);
+    } catch (const std::bad_alloc&) {
+    }
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+T* LSCQ<T, WaitPolicy, PoolPolicy>::dequeue() {
+    detail::ActiveOpsGuard active_guard(enter_epoch());
+
+    // Checked only after publishing to the shard, which closes the destructor race window.
+    if (closing_.load(std::memory_order_seq_cst)) {
+        return nullptr;
+    }
+
+    while (true) {
+        // seq_cst (a plain load on x86 and AArch64) orders it after enter_epoch()'s increment.
+        Node* head = head_.load(std::memory_order_seq_cst);
+
+        // 1. Try to dequeue from the head node's SCQP
+        if (T* result = head->scqp.dequeue()) {
+            return result;
+        }
+
+        // 2. No successor: the queue is empty.
+        Node* next = head->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return nullptr;
+        }
+
+        // 3. A successor is only linked after the node was finalized, so enqueues no longer reset
+        // its threshold. Restore it and look once more for elements that landed before the flag.
+        head->scqp.reset_threshold();
+        if (T* result = head->scqp.dequeue()) {
+            return result;
+        }
+
+        // 4. Drained: unlink the node and retire it. While Tail is still ahead of Head (late
+        // tickets taken around the flag), go round again instead of dropping the node.
+        if (head->scqp.is_empty() && unlink_head(head, next)) {
+            retire_nodes(&head, 1, active_guard.counter());
+        }
+    }
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+bool LSCQ<T, WaitPolicy, PoolPolicy>::unlink_head(Node* head, Node* next) {
+    // Move a lagging tail_ off the node first, so that once head_ has passed it no operation that
+    // starts later can reach it from either end. tail_ never falls behind head_ this way.
+    Node* tail = head;
+    tail_.compare_exchange_strong(tail, next, std::memory_order_seq_cst, std::memory_order_relaxed);
+    return head_.compare_exchange_strong(head, next, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed);
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+std::size_t LSCQ<T, WaitPolicy, PoolPolicy>::enqueue_bulk(T* const* ptrs, std::size_t count) {
+    if (ptrs == nullptr || count == 0) {
+        return 0;
+    }
+
+    detail::ActiveOpsGuard active_guard(enter_epoch());
+
+    // Checked only after publishing to the shard, which closes the destructor race window.
+    if (closing_.load(std::memory_order_seq_cst)) {
+        return 0;
+    }
+
+    std::size_t placed = 0;
+    while (placed < count && ptrs[placed] != nullptr) {
+        Node* tail = tail_.load(std::memory_order_seq_cst);  // See enqueue().
+
+        // 1. Fill as much of the tail node as it can take.
+        placed += tail->scqp.enqueue_bulk(ptrs + placed, count - placed);
+        stage_successor_if_due(tail);
+        if (placed == count || ptrs[placed] == nullptr) {
+            break;
+        }
+
+        // 2. Help swing tail_ past a node that has already been extended.
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr) {
+            tail_.compare_exchange_strong(tail, next, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed);
+            continue;
+        }
+
+        // 3. The tail node is full: continue on a successor that already carries the next run.
+        placed += extend_tail(tail, ptrs + placed, count - placed);
+    }
+    return placed;
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+std::size_t LSCQ<T, WaitPolicy, PoolPolicy>::dequeue_bulk(T** out, std::size_t max_count) {
+    if (out == nullptr || max_count == 0) {
+        return 0;
+    }
+
+    detail::ActiveOpsGuard active_guard(enter_epoch());
+
+    // Checked only after publishing to the shard, which closes the destructor race window.
+    if (closing_.load(std::memory_order_seq_cst)) {
+        return 0;
+    }
+
+    // Nodes unlinked by this batch; retired in one call when the batch ends.
+    constexpr std::size_t kMaxRetiredPerFlush = 16;
+    Node* retired[kMaxRetiredPerFlush];
+    std::size_t retired_count = 0;
+
+    std::size_t got = 0;
+    while (got < max_count) {
+        Node* head = head_.load(std::memory_order_seq_cst);  // See dequeue().
+
+        // 1. Drain as much of the head node as possible.
+        const std::size_t n = head->scqp.dequeue_bulk(out + got, max_count - got);
+        got += n;
+        if (n != 0) {
+            continue;  // The node may still hold elements published meanwhile.
+        }
+
+        // 2. Head node looks empty - only move on if a successor has been linked.
+        Node* next = head->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            break;
+        }
+
+        // 3. Finalized: one more pass with a fresh threshold, as in dequeue().
+        head->scqp.reset_threshold();
+        const std::size_t late = head->scqp.dequeue_bulk(out + got, max_count - got);
+        got += late;
+        if (late != 0 || !head->scqp.is_empty()) {
+            continue;
+        }
+
+        // 4. Advance head_ and keep draining from the successor.
+        if (unlink_head(head, next)) {
+            retired[retired_count++] = head;
+            if (retired_count == kMaxRetiredPerFlush) {
+                retire_nodes(retired, retired_count, active_guard.counter());
+                retired_count = 0;
+            }
+        }
+    }
+
+    if (retired_count != 0) {
+        retire_nodes(retired, retired_count, active_guard.counter());
+    }
+    return got;
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+void LSCQ<T, WaitPolicy, PoolPolicy>::retire_nodes(Node* const* nodes, std::size_t count,
+                                                   const std::atomic<int>& own_count) {
+    // Read after the head_ CAS that unlinked the nodes, so any operation that can still hold one
+    // of them entered in this epoch or an earlier one.
+    const std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    for (std::size_t i = 0; i < count; ++i) {
+        nodes[i]->retire_epoch = epoch;
+        nodes[i]->limbo_next = (i + 1 < count) ? nodes[i + 1] : nullptr;
+    }
+
+    ActiveOpsShard& shard = active_ops_shard();
+    Node* top = shard.limbo.load(std::memory_order_relaxed);
+    do {
+        nodes[count - 1]->limbo_next = top;
+    } while (!shard.limbo.compare_exchange_weak(top, nodes[0], std::memory_order_release,
+                                                std::memory_order_relaxed));
+
+    // The caller holds no node pointer across this call, so its own operation does not have to
+    // hold the epoch back: with no other operation in flight the nodes age out right here.
+    for (std::uint64_t step = 0; step < kReclaimLag; ++step) {
+        if (!try_advance_epoch(&own_count)) {
+            break;
+        }
+    }
+    reclaim_limbo(shard);
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+void LSCQ<T, WaitPolicy, PoolPolicy>::reclaim_limbo(ActiveOpsShard& shard) {
+    const std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+
+    // Take the whole list (threads sharing the shard only ever push), recycle what has aged
+    // enough and push the rest back.
+    Node* pending = shard.limbo.exchange(nullptr, std::memory_order_acquire);
+    Node* kept_first = nullptr;
+    Node* kept_last = nullptr;
+    constexpr std::size_t kMaxRecycledPerFlush = 16;
+    Node* recycled[kMaxRecycledPerFlush];
+    std::size_t recycled_count = 0;
+    while (pending != nullptr) {
+        Node* node = pending;
+        pending = node->limbo_next;
+        if (node->retire_epoch + kReclaimLag <= epoch) {
+            recycled[recycled_count++] = node;
+            if (recycled_count == kMaxRecycledPerFlush) {
+                pool_->PutBatch(recycled, recycled_count);
+                recycled_count = 0;
+            }
+        } else {
+            node->limbo_next = kept_first;
+            kept_first = node;
+            if (kept_last == nullptr) {
+                kept_last = node;
+            }
+        }
+    }
+    if (recycled_count != 0) {
+        pool_->PutBatch(recycled, recycled_count);
+    }
+
+    if (kept_first != nullptr) {
+        Node* top = shard.limbo.load(std::memory_order_relaxed);
+        do {
+            kept_last->limbo_next = top;
+        } while (!shard.limbo.compare_exchange_weak(top, kept_first, std::memory_order_release,
+                                                    std::memory_order_relaxed));
+    }
+}
+
+template <class T, class WaitPolicy, class PoolPolicy>
+bool LSCQ<T, WaitPolicy, PoolPolicy>::try_advance_epoch(
+    const std::atomic<int>* quiescent) noexcept {
+    std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    const std::size_t previous_parity = (epoch + 1) & 1u;  // Parity of epoch - 1
+    for (const ActiveOpsShard& shard : active_ops_) {
+        const std::atomic<int>& count = shard.count[previous_parity];
+        const int self = (&count == quiescent) ? 1 : 0;
+        if (count.load(std::memory_order_seq_cst) != self) {
+            return false;
+        }
+    }
+    // Losing the CAS means another thread advanced it, which is just as good.
+    epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst,
+                                   std::memory_order_relaxed);
+    return true;
+}
+
+}  // namespace lscq
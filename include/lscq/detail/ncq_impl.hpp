@@ -1,16 +1,136 @@
 #pragma once
 
-#include <lscq/cas2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <lscq/detail/ring_math.hpp>
+#include <lscq/ncq.hpp>
 
-namespace lscq::detail {
+namespace lscq {
 
-// TSan-safe "atomic" load of a 16-byte Entry via CAS2.
-inline Entry entry_load(Entry* ptr) noexcept {
-    Entry expected{0, 0};
-    // No-op CAS: desired == expected. On success, the value is unchanged. On failure,
-    // cas2 updates `expected` to the current value, giving us an atomic read.
-    (void)lscq::cas2(ptr, expected, expected);
-    return expected;
+template <class T, class WaitPolicy, class RemapPolicy>
+NCQ<T, WaitPolicy, RemapPolicy>::NCQ(std::size_t capacity, RingPlacement placement)
+    : entries_(), capacity_(capacity), slot_mode_(entry_load_mode()), head_(0), tail_(0) {
+    static_assert(sizeof(Entry) == 16);
+    static_assert(alignof(Entry) == 16);
+
+    constexpr std::size_t entries_per_line = detail::kCacheLineSize / sizeof(Entry);  // 4
+    // Whole cache lines, and a whole number of slots per remap slice.
+    constexpr std::size_t granule =
+        entries_per_line > kRemapStride ? entries_per_line : kRemapStride;
+
+    if (capacity_ == 0) {
+        capacity_ = 1;
+    }
+    if (capacity_ < granule) {
+        capacity_ = granule;
+    }
+    capacity_ = detail::round_up(capacity_, granule);
+
+    // Ring storage starts zeroed: every entry is {cycle 0, index 0}, which is all NCQ needs.
+    entries_.reset(capacity_, placement);
+
+    // Figure 5 initialization: Head = Tail = n (cycle 1) while all entries start with cycle 0.
+    head_.store(static_cast<std::uint64_t>(capacity_), std::memory_order_relaxed);
+    tail_.store(static_cast<std::uint64_t>(capacity_), std::memory_order_relaxed);
+}
+
+template <class T, class WaitPolicy, class RemapPolicy>
+NCQ<T, WaitPolicy, RemapPolicy>::~NCQ() = default;
+
+template <class T, class WaitPolicy, class RemapPolicy>
+std::size_t NCQ<T, WaitPolicy, RemapPolicy>::cache_remap(std::size_t idx) const noexcept {
+    // kRemapStride is a compile-time power of two: a mask, two shifts and a multiply.
+    return detail::remap_index<kRemapStride>(idx, capacity_);
+}
+
+template <class T, class WaitPolicy, class RemapPolicy>
+bool NCQ<T, WaitPolicy, RemapPolicy>::enqueue(T index) {
+    if (index == kEmpty) {
+        return false;
+    }
+    return detail::with_cas2_slots(slot_mode_,
+                                   [&](auto slots) { return enqueue_with(slots, index); });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy>
+template <class Slots>
+bool NCQ<T, WaitPolicy, RemapPolicy>::enqueue_with(Slots slots, T index) {
+    const std::uint64_t n = static_cast<std::uint64_t>(capacity_);
+    WaitPolicy backoff;
+    while (true) {
+        std::uint64_t t = tail_.load(std::memory_order_relaxed);
+        const std::uint64_t cycle_t = t / n;
+        const std::size_t j = static_cast<std::size_t>(t % n);
+        const std::size_t remapped_j = cache_remap(j);
+
+        const Entry ent = slots.load(&entries_[remapped_j]);
+        const std::uint64_t cycle_e = ent.cycle_flags;
+
+        if (cycle_e == cycle_t) {
+            // Help to move tail. Tail and Head are plain tickets; every ordering the queue needs
+            // comes from the acquire slot load and the release slot CAS.
+            (void)tail_.compare_exchange_weak(t, t + 1, std::memory_order_relaxed,
+                                              std::memory_order_relaxed);
+            continue;
+        }
+
+        if (cycle_e + 1 != cycle_t) {
+            // Tail is already stale.
+            backoff.wait();
+            continue;
+        }
+
+        Entry expected = ent;
+        const Entry desired{cycle_t, static_cast<std::uint64_t>(index)};
+        if (slots.cas(&entries_[remapped_j], expected, desired, std::memory_order_release)) {
+            // Try to move tail.
+            (void)tail_.compare_exchange_weak(t, t + 1, std::memory_order_relaxed,
+                                              std::memory_order_relaxed);
+            return true;
+        }
+        backoff.wait();
+    }
+}
+
+template <class T, class WaitPolicy, class RemapPolicy>
+T NCQ<T, WaitPolicy, RemapPolicy>::dequeue() {
+    return detail::with_cas2_slots(slot_mode_, [&](auto slots) { return dequeue_with(slots); });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy>
+template <class Slots>
+T NCQ<T, WaitPolicy, RemapPolicy>::dequeue_with(Slots slots) {
+    const std::uint64_t n = static_cast<std::uint64_t>(capacity_);
+    WaitPolicy backoff;
+    while (true) {
+        std::uint64_t h = head_.load(std::memory_order_relaxed);
+        const std::uint64_t cycle_h = h / n;
+        const std::size_t j = static_cast<std::size_t>(h % n);
+        const std::size_t remapped_j = cache_remap(j);
+
+        const Entry ent = slots.load(&entries_[remapped_j]);
+        const std::uint64_t cycle_e = ent.cycle_flags;
+
+        if (cycle_e != cycle_h) {
+            if (cycle_e + 1 == cycle_h) {
+                return kEmpty;  // Empty queue.
+            }
+            backoff.wait();
+            continue;  // Head is already stale.
+        }
+
+        // The acquire slot load above already orders this claim after the read of ent.
+        if (head_.compare_exchange_weak(h, h + 1, std::memory_order_relaxed,
+                                        std::memory_order_relaxed)) {
+            return static_cast<T>(ent.index_or_ptr);
+        }
+        backoff.wait();
+    }
+}
+
+template <class T, class WaitPolicy, class RemapPolicy>
+bool NCQ<T, WaitPolicy, RemapPolicy>::is_empty() const noexcept {
+    return head_.load(std::memory_order_relaxed) >= tail_.load(std::memory_order_relaxed);
 }
 
-}  // namespace lscq::detail
+}  // namespace lscq
@@ -1,18 +1,14 @@
 #pragma once
 
 #include <cstddef>
+#include <lscq/config.hpp>
+#include <lscq/placement.hpp>
 #include <new>
 
-#if defined(__linux__) && defined(__has_include)
-#if __has_include(<numa.h>)
-#define LSCQ_HAS_NUMA 1
+#if LSCQ_HAS_NUMA
 #include <numa.h>
 #include <sched.h>
-#else
-#define LSCQ_HAS_NUMA 0
-#endif
-#else
-#define LSCQ_HAS_NUMA 0
+#include <unistd.h>
 #endif
 
 namespace lscq::detail::numa {
@@ -80,4 +76,79 @@ inline void Free(const Allocation& allocation, std::size_t bytes) noexcept {
     ::operator delete(allocation.ptr);
 }
 
+// Allocate @p bytes according to @p placement through libnuma. Returns nullptr when the request
+// cannot be honoured (default policy, no libnuma, node out of range, allocation failure); the
+// caller then falls back to a regular allocation. Memory from here must go to FreePlaced().
+inline void* AllocatePlaced(std::size_t bytes, const RingPlacement& placement) {
+#if LSCQ_HAS_NUMA
+    if (bytes == 0 || placement.policy == NumaPolicy::kDefault || !Available()) {
+        return nullptr;
+    }
+    switch (placement.policy) {
+        case NumaPolicy::kLocal:
+            // libnuma rounds every request up to whole pages. Below one page a heap allocation is
+            // first-touched by the constructing thread when it is zeroed anyway.
+            if (bytes >= static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))) {
+                return numa_alloc_local(bytes);
+            }
+            return nullptr;
+        case NumaPolicy::kNode:
+            if (placement.node >= 0 && placement.node <= numa_max_node()) {
+                return numa_alloc_onnode(bytes, placement.node);
+            }
+            return nullptr;
+        case NumaPolicy::kInterleave:
+            return numa_alloc_interleaved(bytes);
+        case NumaPolicy::kDefault:
+            break;
+    }
+    return nullptr;
+#else
+    (void)bytes;
+    (void)placement;
+    return nullptr;
+#endif
+}
+
+inline void FreePlaced(void* ptr, std::size_t bytes) noexcept {
+#if LSCQ_HAS_NUMA
+    numa_free(ptr, bytes);
+#else
+    (void)ptr;
+    (void)bytes;
+#endif
+}
+
+// Apply @p placement to an existing, not yet touched mapping (e.g. one from mmap). Returns whether
+// a NUMA policy was installed.
+inline bool BindPlaced(void* ptr, std::size_t bytes, const RingPlacement& placement) noexcept {
+#if LSCQ_HAS_NUMA
+    if (ptr == nullptr || placement.policy == NumaPolicy::kDefault || !Available()) {
+        return false;
+    }
+    switch (placement.policy) {
+        case NumaPolicy::kLocal:
+            numa_setlocal_memory(ptr, bytes);
+            return true;
+        case NumaPolicy::kNode:
+            if (placement.node >= 0 && placement.node <= numa_max_node()) {
+                numa_tonode_memory(ptr, bytes, placement.node);
+                return true;
+            }
+            return false;
+        case NumaPolicy::kInterleave:
+            numa_interleave_memory(ptr, bytes, numa_all_nodes_ptr);
+            return true;
+        case NumaPolicy::kDefault:
+            break;
+    }
+    return false;
+#else
+    (void)ptr;
+    (void)bytes;
+    (void)placement;
+    return false;
+#endif
+}
+
 }  // namespace lscq::detail::numa
@@ -12,7 +12,7 @@
 #endif
 #endif
 
-#if (LSCQ_ARCH_X86_64 || LSCQ_ARCH_X86_32) && LSCQ_COMPILER_MSVC
+#if (LSCQ_ARCH_X86_64 || LSCQ_ARCH_X86_32 || LSCQ_ARCH_ARM64) && LSCQ_COMPILER_MSVC
 #include <intrin.h>
 #endif
 
@@ -31,6 +31,19 @@ inline bool is_aligned_16(const void* ptr) noexcept {
     return (reinterpret_cast<std::uintptr_t>(ptr) & 0x0F) == 0;
 }
 
+// Spin-wait hint: PAUSE on x86, YIELD on AArch64, nothing elsewhere.
+inline void cpu_relax() noexcept {
+#if (LSCQ_ARCH_X86_64 || LSCQ_ARCH_X86_32) && LSCQ_COMPILER_MSVC
+    _mm_pause();
+#elif (LSCQ_ARCH_X86_64 || LSCQ_ARCH_X86_32)
+    __builtin_ia32_pause();
+#elif LSCQ_ARCH_ARM64 && LSCQ_COMPILER_MSVC
+    __yield();
+#elif LSCQ_ARCH_ARM64
+    __asm__ __volatile__("yield" ::: "memory");
+#endif
+}
+
 inline bool cpu_has_cmpxchg16b() noexcept {
 #if (LSCQ_ARCH_X86_64 || LSCQ_ARCH_X86_32)
     // CPUID.(EAX=1):ECX.CX16[bit 13] indicates CMPXCHG16B support.
@@ -60,4 +73,28 @@ inline bool cpu_has_cmpxchg16b() noexcept {
 #endif
 }
 
+inline bool cpu_has_avx() noexcept {
+#if (LSCQ_ARCH_X86_64 || LSCQ_ARCH_X86_32)
+    // CPUID.(EAX=1):ECX.AVX[bit 28]. Processors that enumerate AVX guarantee that 16-byte aligned
+    // SSE/AVX loads and stores are atomic (Intel SDM Vol. 3A 9.1.1, AMD APM Vol. 2 7.3.2).
+    constexpr std::uint32_t kAvxBit = 1u << 28;
+
+#if LSCQ_COMPILER_MSVC
+    int regs[4] = {0, 0, 0, 0};
+    __cpuid(regs, 1);
+    return (static_cast<std::uint32_t>(regs[2]) & kAvxBit) != 0;
+#elif LSCQ_DETAIL_HAS_CPUID_H
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return (ecx & kAvxBit) != 0;
+#else
+    return false;
+#endif
+#else
+    return false;
+#endif
+}
+
 }  // namespace lscq::detail
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <lscq/config.hpp>
+
+// Index/cycle arithmetic shared by the ring queue implementations (the *_impl.hpp headers).
+
+namespace lscq::detail {
+
+inline constexpr std::size_t kCacheLineSize = config::CACHE_LINE_SIZE;
+
+inline bool cycle_less(std::uint64_t a, std::uint64_t b) noexcept {
+    // Signed subtraction handles wraparounds (paper, Figure 8 note).
+    return static_cast<std::int64_t>(a - b) < 0;
+}
+
+// Tail bit that closes a ring to further enqueues (FINALIZE in the paper's LSCQ). Set with a
+// fetch_or; a Tail fetch-add that returns it hands out no ticket. Counters never get near it.
+inline constexpr std::uint64_t kFinalizeBit = 1ULL << 63;
+
+constexpr std::uint64_t tail_ticket(std::uint64_t tail) noexcept { return tail & ~kFinalizeBit; }
+
+constexpr bool is_finalized_tail(std::uint64_t tail) noexcept {
+    return (tail & kFinalizeBit) != 0;
+}
+
+constexpr bool is_power_of_two(std::size_t v) noexcept { return v != 0 && (v & (v - 1)) == 0; }
+
+constexpr std::size_t round_up_pow2(std::size_t v) noexcept {
+    if (v <= 1) {
+        return 1;
+    }
+    if (is_power_of_two(v)) {
+        return v;
+    }
+    std::size_t out = 1;
+    while (out < v) {
+        out <<= 1;
+    }
+    return out;
+}
+
+constexpr std::size_t round_up(std::size_t value, std::size_t alignment) noexcept {
+    return (value + (alignment - 1)) / alignment * alignment;
+}
+
+// log2(v) for a power-of-two v, usable in constant expressions (see log2_pow2_u64 at run time).
+constexpr unsigned log2_pow2(std::size_t v) noexcept {
+    unsigned shift = 0;
+    while ((std::size_t{1} << shift) < v) {
+        ++shift;
+    }
+    return shift;
+}
+
+}  // namespace lscq::detail
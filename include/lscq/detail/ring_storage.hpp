@@ -0,0 +1,225 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <lscq/config.hpp>
+#include <lscq/detail/numa_utils.hpp>
+#include <lscq/detail/ring_math.hpp>
+#include <lscq/placement.hpp>
+#include <new>
+#include <type_traits>
+
+#if LSCQ_PLATFORM_LINUX
+#include <sys/mman.h>
+#endif
+
+namespace lscq::detail {
+
+/** @brief Huge page size assumed for ring mappings (x86-64 / AArch64 4K-granule PMD size). */
+inline constexpr std::size_t kHugePageSize = std::size_t{2} << 20;
+
+/**
+ * @brief Smallest ring mapped anonymously instead of taken from the heap and zeroed.
+ *
+ * An anonymous mapping is zero-filled by the kernel and committed page by page on first touch,
+ * so a ring that size costs O(1) to create. Below this, a syscall plus a fault per page costs
+ * more than clearing the bytes.
+ */
+inline constexpr std::size_t kAnonMapThreshold = std::size_t{64} << 10;
+
+enum class RingSource : std::uint8_t {
+    kNone,
+    kHeap,       // Aligned operator new.
+    kNuma,       // libnuma allocation.
+    kHugeTlb,    // mmap(MAP_HUGETLB) from the hugetlbfs pool.
+    kTransHuge,  // mmap + madvise(MADV_HUGEPAGE), transparent huge pages.
+    kAnonMap,    // Plain anonymous mmap, zero-filled and committed on first touch.
+};
+
+struct RingAllocation {
+    void* ptr{nullptr};
+    std::size_t bytes{0};  // Mapped/allocated length, needed to release kNuma and mmap memory.
+    RingSource source{RingSource::kNone};
+    bool on_numa{false};
+};
+
+#if LSCQ_PLATFORM_LINUX
+// Map a huge-page backed ring of at least @p bytes, rounded up to whole huge pages. Tries the
+// hugetlbfs pool first (guaranteed huge pages, but usually empty unless vm.nr_hugepages is set),
+// then a 2 MiB aligned anonymous mapping advised for THP. Returns an empty allocation if neither
+// is available.
+inline RingAllocation MapHugeRing(std::size_t bytes, const RingPlacement& placement) {
+    const std::size_t len = round_up(bytes, kHugePageSize);
+#if defined(MAP_HUGETLB)
+    void* p = ::mmap(nullptr, len, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p != MAP_FAILED) {
+        return {p, len, RingSource::kHugeTlb, numa::BindPlaced(p, len, placement)};
+    }
+#endif
+#if defined(MADV_HUGEPAGE)
+    // Over-map by one huge page and trim, so the ring starts on a huge page boundary and the
+    // kernel can back every 2 MiB of it with a single PMD entry.
+    void* raw = ::mmap(nullptr, len + kHugePageSize, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return {};
+    }
+    const auto base = reinterpret_cast<std::uintptr_t>(raw);
+    const std::uintptr_t aligned = round_up(base, kHugePageSize);
+    const std::size_t head = aligned - base;
+    if (head != 0) {
+        ::munmap(raw, head);
+    }
+    ::munmap(reinterpret_cast<void*>(aligned + len), kHugePageSize - head);
+
+    void* ring = reinterpret_cast<void*>(aligned);
+    if (::madvise(ring, len, MADV_HUGEPAGE) != 0) {
+        ::munmap(ring, len);  // THP not supported by this kernel.
+        return {};
+    }
+    return {ring, len, RingSource::kTransHuge, numa::BindPlaced(ring, len, placement)};
+#else
+    (void)placement;
+    return {};
+#endif
+}
+#endif
+
+// Ring allocations are cache-line aligned and zero-filled on every path: libnuma and mmap hand
+// out whole zero pages (committed only when first touched), small heap rings are cleared here.
+inline RingAllocation AllocateRing(std::size_t bytes, const RingPlacement& placement) {
+    if (bytes == 0) {
+        return {};
+    }
+#if LSCQ_PLATFORM_LINUX
+    if (placement.huge_pages) {
+        RingAllocation mapped = MapHugeRing(bytes, placement);
+        if (mapped.ptr != nullptr) {
+            return mapped;
+        }
+    }
+#endif
+    if (void* p = numa::AllocatePlaced(bytes, placement)) {
+        return {p, bytes, RingSource::kNuma, true};
+    }
+#if LSCQ_PLATFORM_LINUX
+    if (bytes >= kAnonMapThreshold) {
+        void* p =
+            ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p != MAP_FAILED) {
+            return {p, bytes, RingSource::kAnonMap, false};
+        }
+    }
+#endif
+    void* p = ::operator new(bytes, std::align_val_t(kCacheLineSize));
+    std::memset(p, 0, bytes);
+    return {p, bytes, RingSource::kHeap, false};
+}
+
+inline void FreeRing(const RingAllocation& allocation) noexcept {
+    switch (allocation.source) {
+        case RingSource::kNone:
+            break;
+        case RingSource::kHeap:
+            ::operator delete(allocation.ptr, std::align_val_t(kCacheLineSize));
+            break;
+        case RingSource::kNuma:
+            numa::FreePlaced(allocation.ptr, allocation.bytes);
+            break;
+        case RingSource::kHugeTlb:
+        case RingSource::kTransHuge:
+        case RingSource::kAnonMap:
+#if LSCQ_PLATFORM_LINUX
+            ::munmap(allocation.ptr, allocation.bytes);
+#endif
+            break;
+    }
+}
+
+/**
+ * @brief Owning array of trivially destructible ring slots with NUMA / huge-page placement.
+ *
+ * Stands in for `std::unique_ptr<E[]>` in the ring queues. Slots start as all-zero bytes. SCQ,
+ * SCQ64, SCQP and NCQ encode "empty, safe, cycle 0" that way and skip initialization, so creating
+ * one of them is O(1) for mapped rings and each page is committed (and first-touched, which decides
+ * its NUMA node under the default policy) by the first ticket that reaches it.
+ */
+template <class E>
+class RingStorage {
+    static_assert(std::is_trivially_destructible_v<E>, "ring slots must be trivially destructible");
+
+   public:
+    RingStorage() noexcept = default;
+    RingStorage(std::size_t count, const RingPlacement& placement)
+        : allocation_(AllocateRing(count * sizeof(E), placement)) {}
+
+    ~RingStorage() { FreeRing(allocation_); }
+
+    RingStorage(const RingStorage&) = delete;
+    RingStorage& operator=(const RingStorage&) = delete;
+    RingStorage(RingStorage&&) = delete;
+    RingStorage& operator=(RingStorage&&) = delete;
+
+    /** @brief Release the current slots (if any) and allocate @p count new ones. */
+    void reset(std::size_t count, const RingPlacement& placement) {
+        FreeRing(allocation_);
+        allocation_ = {};
+        allocation_ = AllocateRing(count * sizeof(E), placement);
+    }
+
+    E* get() const noexcept { return static_cast<E*>(allocation_.ptr); }
+    E& operator[](std::size_t i) const noexcept { return get()[i]; }
+    explicit operator bool() const noexcept { return allocation_.ptr != nullptr; }
+
+    /** @brief Whether a NUMA policy from the placement was applied to the slots. */
+    bool on_numa() const noexcept { return allocation_.on_numa; }
+    /**
+     * @brief Whether the slots live in a huge-page mapping (hugetlbfs, or THP-advised; with THP
+     * the kernel may still fall back to base pages under fragmentation).
+     */
+    bool on_huge_pages() const noexcept {
+        return allocation_.source == RingSource::kHugeTlb ||
+               allocation_.source == RingSource::kTransHuge;
+    }
+
+   private:
+    RingAllocation allocation_{};
+};
+
+/**
+ * @brief RingStorage's interface over @p N slots held inside the owning object.
+ *
+ * The ring of a FixedCapacity queue. The slots are value-initialized (all-zero bytes, the same
+ * starting state as a RingStorage allocation) and live wherever the queue object does, so there
+ * is no placement: @ref reset ignores it and @ref on_numa / @ref on_huge_pages are always false.
+ * Like RingStorage, constness of the holder does not extend to the slots.
+ */
+template <class E, std::size_t N>
+class InlineRing {
+    static_assert(std::is_trivially_destructible_v<E>, "ring slots must be trivially destructible");
+
+   public:
+    InlineRing() noexcept = default;
+
+    InlineRing(const InlineRing&) = delete;
+    InlineRing& operator=(const InlineRing&) = delete;
+    InlineRing(InlineRing&&) = delete;
+    InlineRing& operator=(InlineRing&&) = delete;
+
+    /** @brief No-op: the @p count (always N) slots exist and are zeroed from construction. */
+    void reset(std::size_t /*count*/, const RingPlacement& /*placement*/) noexcept {}
+
+    E* get() const noexcept { return slots_; }
+    E& operator[](std::size_t i) const noexcept { return slots_[i]; }
+    explicit operator bool() const noexcept { return true; }
+
+    bool on_numa() const noexcept { return false; }
+    bool on_huge_pages() const noexcept { return false; }
+
+   private:
+    alignas(kCacheLineSize) mutable E slots_[N]{};
+};
+
+}  // namespace lscq::detail
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <lscq/detail/bit.hpp>
+#include <lscq/detail/likely.hpp>
+#include <lscq/detail/ring_math.hpp>
+#include <lscq/scq64.hpp>
+
+namespace lscq {
+
+namespace detail {
+
+// 8 with the default 64-byte LSCQ_CACHE_LINE.
+inline constexpr std::size_t kScq64EntriesPerLine = kCacheLineSize / sizeof(std::uint64_t);
+
+}  // namespace detail
+
+template <class T, class WaitPolicy>
+SCQ64<T, WaitPolicy>::SCQ64(std::size_t scqsize, RingPlacement placement)
+    : Tickets(ring_size(scqsize)),
+      entries_(),
+      unsafe_bit_(static_cast<std::uint64_t>(scqsize_)),
+      low_mask_((static_cast<std::uint64_t>(scqsize_) << 1) - 1),
+      line_shift_(detail::log2_pow2_u64(static_cast<std::uint64_t>(scqsize_) /
+                                        detail::kScq64EntriesPerLine)) {
+    // Ring storage starts zeroed, which encodes cycle 0, IsSafe, ⊥ in every slot.
+    entries_.reset(scqsize_, placement);
+}
+
+template <class T, class WaitPolicy>
+std::size_t SCQ64<T, WaitPolicy>::ring_size(std::size_t requested) noexcept {
+    // Power-of-two ring of at least one cache line, so cache_remap always has whole lines.
+    return DynamicCapacity::ring_size<detail::kScq64EntriesPerLine>(requested);
+}
+
+template <class T, class WaitPolicy>
+SCQ64<T, WaitPolicy>::~SCQ64() = default;
+
+template <class T, class WaitPolicy>
+std::size_t SCQ64<T, WaitPolicy>::cache_remap(std::size_t idx) const noexcept {
+    // kScq64EntriesPerLine 8-byte entries per line: consecutive tickets land on different lines.
+    const std::size_t line = idx / detail::kScq64EntriesPerLine;
+    const std::size_t offset = idx & (detail::kScq64EntriesPerLine - 1u);
+    return (offset << line_shift_) | line;
+}
+
+template <class T, class WaitPolicy>
+bool SCQ64<T, WaitPolicy>::try_enqueue_at(std::uint64_t t, T index) {
+    const std::uint64_t cycle_t = ticket_cycle(t);
+    Slot& slot = entries_[cache_remap(static_cast<std::size_t>(t & bottom_))];
+
+    WaitPolicy backoff;
+    std::uint64_t ent = slot.load(std::memory_order_acquire);
+    while (true) {
+        if (LSCQ_LIKELY(detail::cycle_less(slot_cycle(ent), cycle_t) && slot_is_empty(ent))) {
+            if (LSCQ_LIKELY(slot_is_safe(ent) || head_.load(std::memory_order_acquire) <= t)) {
+                // On failure `ent` is reloaded with the current slot value.
+                const std::uint64_t value = static_cast<std::uint64_t>(index);
+                if (slot.compare_exchange_weak(ent, cycle_t | encode_index(value),
+                                               std::memory_order_acq_rel,
+                                               std::memory_order_acquire)) {
+                    reset_threshold_after_enqueue();
+                    return true;
+                }
+                backoff.wait();
+                continue;  // Retry same slot (Figure 8 line 19).
+            }
+        }
+
+        return false;  // Give up on this ticket; the caller takes a new Tail.
+    }
+}
+
+template <class T, class WaitPolicy>
+T SCQ64<T, WaitPolicy>::try_dequeue_at(std::uint64_t h) {
+    const std::uint64_t cycle_h = ticket_cycle(h);
+    Slot& slot = entries_[cache_remap(static_cast<std::size_t>(h & bottom_))];
+
+    // Retry casing the same slot (Figure 8 line 38 goto 29).
+    WaitPolicy backoff;
+    std::uint64_t ent = slot.load(std::memory_order_acquire);
+    while (true) {
+        const std::uint64_t cycle_e = slot_cycle(ent);
+
+        if (LSCQ_LIKELY(cycle_e == cycle_h)) {
+            // IsSafe only gates enqueuers (Figure 8 line 18), so consume regardless of it.
+            if (slot_is_empty(ent)) {
+                return kEmpty;
+            }
+
+            // Consume: AND stores ⊥ (clears the index bits) while preserving Cycle/IsSafe.
+            slot.fetch_and(~bottom_, std::memory_order_acq_rel);
+            return static_cast<T>(decode_index(ent));
+        }
+
+        // Default: clear IsSafe (Figure 8 line 33). If empty, advance Cycle to Cycle(H) and
+        // preserve IsSafe (Figure 8 line 35).
+        std::uint64_t desired = ent | unsafe_bit_;
+        if (slot_is_empty(ent)) {
+            desired = cycle_h | (ent & unsafe_bit_);
+        }
+
+        if (detail::cycle_less(cycle_e, cycle_h)) {
+            if (!slot.compare_exchange_weak(ent, desired, std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+                backoff.wait();
+                continue;
+            }
+        }
+
+        return kEmpty;
+    }
+}
+
+template <class T, class WaitPolicy>
+bool SCQ64<T, WaitPolicy>::enqueue(T index) {
+    if (LSCQ_UNLIKELY(index == kEmpty || static_cast<std::uint64_t>(index) >= bottom_)) {
+        return false;
+    }
+    return enqueue_one([&](std::uint64_t t) { return try_enqueue_at(t, index); });
+}
+
+template <class T, class WaitPolicy>
+T SCQ64<T, WaitPolicy>::dequeue() {
+    return dequeue_one(kEmpty, [&](std::uint64_t h) { return try_dequeue_at(h); });
+}
+
+template <class T, class WaitPolicy>
+std::size_t SCQ64<T, WaitPolicy>::enqueue_bulk(const T* items, std::size_t count) {
+    if (items == nullptr) {
+        return 0;
+    }
+
+    // Only the valid prefix is enqueued, so the caller can tell exactly which items were taken.
+    std::size_t valid = 0;
+    while (valid < count && items[valid] != kEmpty &&
+           static_cast<std::uint64_t>(items[valid]) < bottom_) {
+        ++valid;
+    }
+
+    return enqueue_batch(valid, [&](std::uint64_t t, std::size_t i) {
+        return try_enqueue_at(t, items[i]);
+    });
+}
+
+template <class T, class WaitPolicy>
+std::size_t SCQ64<T, WaitPolicy>::dequeue_bulk(T* out, std::size_t max_count) {
+    if (out == nullptr || max_count == 0) {
+        return 0;
+    }
+    return dequeue_batch(out, max_count, kEmpty,
+                         [&](std::uint64_t h) { return try_dequeue_at(h); });
+}
+
+template <class T, class WaitPolicy>
+bool SCQ64<T, WaitPolicy>::is_empty() const noexcept {
+    return Tickets::ring_is_empty();
+}
+
+template <class T, class WaitPolicy>
+std::size_t SCQ64<T, WaitPolicy>::size_approx() const noexcept {
+    return Tickets::ring_size_approx();
+}
+
+template <class T, class WaitPolicy>
+void SCQ64<T, WaitPolicy>::finalize() noexcept {
+    Tickets::finalize_tail();
+}
+
+template <class T, class WaitPolicy>
+bool SCQ64<T, WaitPolicy>::is_finalized() const noexcept {
+    return Tickets::tail_is_finalized();
+}
+
+template <class T, class WaitPolicy>
+void SCQ64<T, WaitPolicy>::reopen() noexcept {
+    const std::uint64_t head = head_.load(std::memory_order_relaxed);
+    const std::uint64_t tail = detail::tail_ticket(tail_.load(std::memory_order_relaxed));
+    // Tickets taken after FINALIZE left Tail ahead of Head without writing a slot; moving Head up
+    // drops them as if dequeuers had found them empty.
+    if (tail > head) {
+        head_.store(tail, std::memory_order_relaxed);
+    }
+    tail_.store(tail, std::memory_order_relaxed);
+}
+
+template <class T, class WaitPolicy>
+void SCQ64<T, WaitPolicy>::reset_threshold() noexcept {
+    Tickets::reset_threshold();
+}
+
+}  // namespace lscq
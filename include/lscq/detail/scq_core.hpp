@@ -0,0 +1,319 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <lscq/capacity.hpp>
+#include <lscq/config.hpp>
+#include <lscq/detail/likely.hpp>
+#include <lscq/detail/ring_math.hpp>
+
+namespace lscq::detail {
+
+// Tail - Head bounds the occupancy from above: a ticket an enqueuer abandons is always one Head
+// has already passed (or one whose slot still holds an element), so the ticket counters can
+// stand in for success counters. Head may run ahead of Tail while the ring is empty.
+inline bool queue_is_full(std::uint64_t head, std::uint64_t tail, std::uint64_t scqsize) noexcept {
+    return tail >= head && (tail - head) >= scqsize;
+}
+
+/**
+ * @brief Head, Tail and threshold of an SCQ-family ring, with the steps that only touch them.
+ *
+ * SCQ, SCQ64 and SCQP differ in the slot layout and in how one ticket is tried against its slot.
+ * Taking tickets, charging the threshold for the ones that come back empty, catching Tail up
+ * with Head and FINALIZE are the same for all of them and live here once. The queues derive from
+ * this struct and pass their per-ticket steps in as callables, which the compiler inlines into
+ * these loops.
+ *
+ * Tail may carry kFinalizeBit (SCQ64, SCQP). SCQ never sets it, so masking it off and testing
+ * the fetch-add result for it are no-ops there.
+ *
+ * @tparam WaitPolicy Back-off between abandoned enqueue tickets (see wait_policy.hpp).
+ * @tparam kThresholdQsizes Threshold reset value in units of QSIZE (minus one): 3 is the paper's
+ * 3n - 1 (SCQ, SCQ64), SCQP uses 4n - 1.
+ * @tparam kReportsFull Whether enqueues fail on a full ring (SCQP) instead of spinning until a
+ * slot frees up (SCQ, SCQ64).
+ * @tparam Capacity DynamicCapacity or FixedCapacity<N> (see capacity.hpp); the ring sizes
+ * (scqsize_, qsize_, bottom_, scq_shift_) come from this base.
+ */
+template <class WaitPolicy, unsigned kThresholdQsizes, bool kReportsFull, class Capacity>
+struct ScqTickets : Capacity {
+    using Capacity::qsize_;
+    using Capacity::scqsize_;
+
+    // Head and Tail start at SCQSIZE (cycle 1) while every slot starts in cycle 0.
+    explicit ScqTickets(std::size_t scqsize) noexcept
+        : Capacity(scqsize),
+          head_(static_cast<std::uint64_t>(scqsize_)),
+          tail_(static_cast<std::uint64_t>(scqsize_)),
+          threshold_(threshold_reset_value()) {}
+
+    std::int64_t threshold_reset_value() const noexcept {
+        return static_cast<std::int64_t>(kThresholdQsizes * static_cast<std::uint64_t>(qsize_) -
+                                         1u);
+    }
+
+    // Threshold is only a progress hint: the slot CAS and the dequeuer's slot load carry all data
+    // ordering, so every threshold access is relaxed.
+    void reset_threshold() noexcept {
+        threshold_.store(threshold_reset_value(), std::memory_order_relaxed);
+    }
+
+    void reset_threshold_after_enqueue() noexcept {
+        const std::int64_t threshold_reset = threshold_reset_value();
+        if (threshold_.load(std::memory_order_relaxed) != threshold_reset) {
+            threshold_.store(threshold_reset, std::memory_order_relaxed);
+        }
+    }
+
+    bool threshold_allows_dequeue() noexcept {
+        // Figure 8 line 24: negative threshold is a fast empty check.
+        if (LSCQ_LIKELY(threshold_.load(std::memory_order_relaxed) >= 0)) {
+            return true;
+        }
+
+        // Threshold exhausted - check if queue is truly empty before reporting empty.
+        // This handles the case where producers have completed but queue still has elements.
+        const std::uint64_t head_now = head_.load(std::memory_order_acquire);
+        const std::uint64_t tail_now = tail_ticket(tail_.load(std::memory_order_acquire));
+
+        // If tail > head, queue is not empty - reset threshold and continue.
+        if (tail_now > head_now) {
+            reset_threshold();
+            return true;
+        }
+        // Queue appears empty or threshold legitimately exhausted
+        return false;
+    }
+
+    // Charges @p count Head tickets that came back empty, the last of them @p last_h, to the
+    // threshold. Returns whether the dequeuer should take another ticket.
+    bool settle_empty_tickets(std::uint64_t last_h, std::uint64_t count) noexcept {
+        const std::uint64_t t = tail_ticket(tail_.load(std::memory_order_acquire));
+        const std::int64_t prev =
+            threshold_.fetch_sub(static_cast<std::int64_t>(count), std::memory_order_relaxed);
+        const std::int64_t next = prev - static_cast<std::int64_t>(count);
+
+        // Dequeue retry optimization: keep taking tickets for a bounded number of iterations
+        // (threshold) unless the queue is observed empty (t <= h + 1).
+        if (LSCQ_UNLIKELY(t <= last_h + 1)) {
+            if (next <= 0) {
+                const std::uint64_t head_now = head_.load(std::memory_order_acquire);
+                const std::uint64_t tail_now = tail_ticket(tail_.load(std::memory_order_acquire));
+                catch_up_tail(head_now, tail_now);
+            }
+            return false;
+        }
+
+        if (LSCQ_LIKELY(next > 0)) {
+            return true;
+        }
+
+        const std::uint64_t head_now = head_.load(std::memory_order_acquire);
+        const std::uint64_t tail_now = tail_ticket(tail_.load(std::memory_order_acquire));
+
+        // Threshold ran out with Tail still ahead of Head: elements remain, so reset and retry.
+        if (tail_now > head_now) {
+            reset_threshold();
+            return true;
+        }
+        catch_up_tail(head_now, tail_now);
+        return false;
+    }
+
+    // Queue appears empty with Head more than a ring ahead of Tail: fixState, and give the
+    // threshold back.
+    void catch_up_tail(std::uint64_t head_now, std::uint64_t tail_now) noexcept {
+        if (head_now > tail_now && (head_now - tail_now) > static_cast<std::uint64_t>(scqsize_)) {
+            fixState();
+            reset_threshold();
+        }
+    }
+
+    void fixState() noexcept {
+        const std::uint64_t scqsize = static_cast<std::uint64_t>(scqsize_);
+
+        while (true) {
+            std::uint64_t h = head_.load(std::memory_order_acquire);
+            std::uint64_t t = tail_.load(std::memory_order_acquire);
+            const std::uint64_t ticket = tail_ticket(t);
+
+            if (h <= ticket || (h - ticket) <= scqsize) {
+                return;
+            }
+
+            // Catch Tail up without dropping FINALIZE.
+            if (tail_.compare_exchange_weak(t, h | (t & kFinalizeBit), std::memory_order_release,
+                                            std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    // Single enqueue: take Tail tickets until @p try_at(t) places the value on ticket t. Fails
+    // once Tail is finalized, or (kReportsFull) when the ring is full.
+    template <class TryEnqueueAt>
+    bool enqueue_one(TryEnqueueAt&& try_at) {
+        WaitPolicy backoff;
+        while (true) {
+            if constexpr (kReportsFull) {
+                // Checked before the FAA so that enqueues on a full or finalized ring do not burn
+                // tickets.
+                const std::uint64_t head = head_.load(std::memory_order_relaxed);
+                const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+                if (LSCQ_UNLIKELY(is_finalized_tail(tail)) ||
+                    queue_is_full(head, tail, static_cast<std::uint64_t>(scqsize_))) {
+                    return false;
+                }
+            }
+
+            const std::uint64_t t = tail_.fetch_add(1, std::memory_order_acq_rel);
+            if (LSCQ_UNLIKELY(is_finalized_tail(t))) {
+                return false;  // Lost the race against finalize(): no ticket.
+            }
+            if (LSCQ_LIKELY(try_at(t))) {
+                return true;
+            }
+            // Abandoned tickets mean contention with dequeuers or a full ring, so back off
+            // before taking the next one.
+            backoff.wait();
+        }
+    }
+
+    // Bulk enqueue of @p count values, one Tail claim per round. @p try_at(t, i) tries to place
+    // value i on ticket t. Returns the number of values placed, which is always a prefix.
+    template <class TryEnqueueAt>
+    std::size_t enqueue_batch(std::size_t count, TryEnqueueAt&& try_at) {
+        std::size_t placed = 0;
+        while (placed < count) {
+            std::uint64_t want = static_cast<std::uint64_t>(count - placed);
+            if constexpr (kReportsFull) {
+                const std::uint64_t scqsize = static_cast<std::uint64_t>(scqsize_);
+                const std::uint64_t head = head_.load(std::memory_order_relaxed);
+                const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+                if (LSCQ_UNLIKELY(is_finalized_tail(tail)) ||
+                    queue_is_full(head, tail, scqsize)) {
+                    break;
+                }
+                // Claim no more tickets than the free space allows.
+                const std::uint64_t used = tail > head ? tail - head : 0;
+                if (want > scqsize - used) {
+                    want = scqsize - used;
+                }
+            }
+
+            // One Tail FAA for everything that is still pending. Tickets whose slot is unusable
+            // (Figure 8 line 18 fails) are abandoned exactly like in the single-item path; the
+            // items they would have carried slide to the next ticket of the batch or to the next
+            // claim.
+            const std::uint64_t t0 = tail_.fetch_add(want, std::memory_order_acq_rel);
+            if (LSCQ_UNLIKELY(is_finalized_tail(t0))) {
+                break;  // All of this claim came after FINALIZE.
+            }
+            for (std::uint64_t i = 0; i < want; ++i) {
+                if (try_at(t0 + i, placed)) {
+                    ++placed;
+                }
+            }
+        }
+        return placed;
+    }
+
+    // Single dequeue: take Head tickets until one yields a value or the threshold says the ring
+    // is empty. @p try_at(h) returns the value of ticket h, or @p empty if it had none.
+    template <class Value, class TryDequeueAt>
+    Value dequeue_one(Value empty, TryDequeueAt&& try_at) {
+        if (LSCQ_UNLIKELY(!threshold_allows_dequeue())) {
+            return empty;
+        }
+
+        while (true) {
+            const std::uint64_t h = head_.fetch_add(1, std::memory_order_acq_rel);
+            const Value value = try_at(h);
+            if (LSCQ_LIKELY(value != empty)) {
+                return value;
+            }
+            if (!settle_empty_tickets(h, 1)) {
+                return empty;
+            }
+        }
+    }
+
+    // Bulk dequeue of up to @p max_count values into @p out, one Head claim per round; @p try_at
+    // as for dequeue_one.
+    template <class Value, class TryDequeueAt>
+    std::size_t dequeue_batch(Value* out, std::size_t max_count, Value empty,
+                              TryDequeueAt&& try_at) {
+        if (LSCQ_UNLIKELY(!threshold_allows_dequeue())) {
+            return 0;
+        }
+
+        std::size_t got = 0;
+        while (got < max_count) {
+            // Never claim more Head tickets than the Tail snapshot can back: every surplus ticket
+            // would invalidate a slot and push an in-flight enqueuer to a new ticket.
+            const std::uint64_t head_now = head_.load(std::memory_order_acquire);
+            const std::uint64_t tail_now = tail_ticket(tail_.load(std::memory_order_acquire));
+            if (tail_now <= head_now) {
+                break;
+            }
+            std::uint64_t want = tail_now - head_now;
+            if (want > static_cast<std::uint64_t>(max_count - got)) {
+                want = static_cast<std::uint64_t>(max_count - got);
+            }
+
+            const std::uint64_t h0 = head_.fetch_add(want, std::memory_order_acq_rel);
+            std::uint64_t empty_tickets = 0;
+            for (std::uint64_t i = 0; i < want; ++i) {
+                const Value value = try_at(h0 + i);
+                if (value != empty) {
+                    out[got++] = value;
+                } else {
+                    ++empty_tickets;
+                }
+            }
+
+            // Unused tickets pay the threshold exactly as the same number of single dequeues
+            // would.
+            if (empty_tickets != 0 && !settle_empty_tickets(h0 + want - 1, empty_tickets)) {
+                return got;
+            }
+        }
+
+        if (got == 0) {
+            // Nothing claimable in bulk; fall back to the single-item path so that a bulk call
+            // never reports empty where a single dequeue would have found an element.
+            const Value value = dequeue_one(empty, try_at);
+            if (value != empty) {
+                out[got++] = value;
+            }
+        }
+        return got;
+    }
+
+    bool ring_is_empty() const noexcept {
+        return head_.load(std::memory_order_relaxed) >=
+               tail_ticket(tail_.load(std::memory_order_relaxed));
+    }
+
+    std::size_t ring_size_approx() const noexcept {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        const std::uint64_t tail = tail_ticket(tail_.load(std::memory_order_relaxed));
+        // Head runs past Tail while dequeuers probe an empty ring.
+        return tail > head ? static_cast<std::size_t>(tail - head) : 0;
+    }
+
+    void finalize_tail() noexcept { tail_.fetch_or(kFinalizeBit, std::memory_order_release); }
+
+    bool tail_is_finalized() const noexcept {
+        return is_finalized_tail(tail_.load(std::memory_order_acquire));
+    }
+
+    alignas(config::CACHE_LINE_SIZE) std::atomic<std::uint64_t> head_;
+    alignas(config::CACHE_LINE_SIZE) std::atomic<std::uint64_t> tail_;
+    // Dynamic threshold (init: kThresholdQsizes * QSIZE - 1).
+    alignas(config::CACHE_LINE_SIZE) std::atomic<std::int64_t> threshold_;
+};
+
+}  // namespace lscq::detail
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <lscq/detail/atomic_or.hpp>
+#include <lscq/detail/likely.hpp>
+#include <lscq/detail/ring_math.hpp>
+#include <lscq/scq.hpp>
+
+namespace lscq {
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+SCQ<T, WaitPolicy, RemapPolicy, Capacity>::SCQ(std::size_t scqsize, RingPlacement placement)
+    : Tickets(ring_size(scqsize)),
+      entries_(),
+      slot_mode_(entry_load_mode()) {
+    static_assert(sizeof(Entry) == 16);
+    static_assert(alignof(Entry) == 16);
+
+    // Ring storage starts zeroed, which encodes cycle 0, IsSafe, ⊥ in every slot.
+    entries_.reset(scqsize_, placement);
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQ<T, WaitPolicy, RemapPolicy, Capacity>::ring_size(std::size_t requested) noexcept {
+    // SCQ requires a power-of-two ring (SCQSIZE = 2n) of at least 4 slots, and at least one slot
+    // per remap slice.
+    return Capacity::template ring_size<(kRemapStride > 4 ? kRemapStride : 4)>(requested);
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+SCQ<T, WaitPolicy, RemapPolicy, Capacity>::~SCQ() = default;
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQ<T, WaitPolicy, RemapPolicy, Capacity>::cache_remap(std::size_t idx) const noexcept {
+    // kRemapStride is a compile-time power of two: a mask, two shifts and a multiply.
+    return detail::remap_index<kRemapStride>(idx, scqsize_);
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+template <class Slots>
+bool SCQ<T, WaitPolicy, RemapPolicy, Capacity>::try_enqueue_at(Slots slots, std::uint64_t t,
+                                                               std::uint64_t value) {
+    const std::uint64_t cycle_t = t >> scq_shift_;
+    const std::size_t j = cache_remap(static_cast<std::size_t>(t & bottom_));
+
+    WaitPolicy backoff;
+    while (true) {
+        const Entry ent = slots.load(&entries_[j]);
+        const std::uint64_t cycle_e = unpack_cycle(ent.cycle_flags);
+
+        if (LSCQ_LIKELY(detail::cycle_less(cycle_e, cycle_t) && ent.index_or_ptr == kEmptySlot)) {
+            const bool is_safe = unpack_is_safe(ent.cycle_flags);
+            if (LSCQ_LIKELY(is_safe || head_.load(std::memory_order_acquire) <= t)) {
+                Entry expected = ent;
+                const Entry desired{pack_cycle_flags(cycle_t, true), encode_index(value)};
+                // Release publishes the value to the dequeuer's acquire slot load.
+                if (slots.cas(&entries_[j], expected, desired, std::memory_order_release)) {
+                    reset_threshold_after_enqueue();
+                    return true;
+                }
+                backoff.wait();
+                continue;  // Retry same slot (Figure 8 line 19).
+            }
+        }
+
+        return false;  // Give up on this ticket; the caller takes a new Tail.
+    }
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+template <class Slots>
+T SCQ<T, WaitPolicy, RemapPolicy, Capacity>::try_dequeue_at(Slots slots, std::uint64_t h) {
+    const std::uint64_t cycle_h = h >> scq_shift_;
+    const std::size_t j = cache_remap(static_cast<std::size_t>(h & bottom_));
+
+    // Retry loading/casing the same slot (Figure 8 line 38 goto 29).
+    WaitPolicy backoff;
+    while (true) {
+        const Entry ent = slots.load(&entries_[j]);
+        const std::uint64_t cycle_e = unpack_cycle(ent.cycle_flags);
+
+        if (LSCQ_LIKELY(cycle_e == cycle_h)) {
+            // IsSafe only gates enqueuers (Figure 8 line 18): a dequeuer from a later cycle may
+            // have cleared it while this element was still waiting for us, so consume regardless.
+            if (ent.index_or_ptr == kEmptySlot) {
+                return kEmpty;
+            }
+
+            // Consume: atomic AND stores ⊥ (clears the index bits) while preserving Cycle/IsSafe.
+            detail::atomic_and_u64(&entries_[j].index_or_ptr, ~bottom_);
+            return static_cast<T>(decode_index(ent.index_or_ptr));
+        }
+
+        // Default: clear IsSafe (Figure 8 line 33). If empty, advance Cycle to Cycle(H) and
+        // preserve IsSafe (Figure 8 line 35).
+        Entry desired{pack_cycle_flags(cycle_e, false), ent.index_or_ptr};
+        if (ent.index_or_ptr == kEmptySlot) {
+            desired = Entry{pack_cycle_flags(cycle_h, unpack_is_safe(ent.cycle_flags)), kEmptySlot};
+        }
+
+        if (detail::cycle_less(cycle_e, cycle_h)) {
+            Entry expected = ent;
+            if (!slots.cas(&entries_[j], expected, desired, std::memory_order_release)) {
+                backoff.wait();
+                continue;
+            }
+        }
+
+        return kEmpty;
+    }
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+bool SCQ<T, WaitPolicy, RemapPolicy, Capacity>::enqueue(T index) {
+    if (LSCQ_UNLIKELY(index == kEmpty)) {
+        return false;
+    }
+    const std::uint64_t value = static_cast<std::uint64_t>(index);
+    if (LSCQ_UNLIKELY(value >= bottom_)) {
+        return false;
+    }
+
+    return detail::with_cas2_slots(slot_mode_, [&](auto slots) {
+        return enqueue_one([&](std::uint64_t t) { return try_enqueue_at(slots, t, value); });
+    });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+T SCQ<T, WaitPolicy, RemapPolicy, Capacity>::dequeue() {
+    return detail::with_cas2_slots(slot_mode_, [&](auto slots) {
+        return dequeue_one(kEmpty, [&](std::uint64_t h) { return try_dequeue_at(slots, h); });
+    });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQ<T, WaitPolicy, RemapPolicy, Capacity>::enqueue_bulk(const T* items,
+                                                                    std::size_t count) {
+    if (items == nullptr) {
+        return 0;
+    }
+
+    // Only the valid prefix is enqueued, so the caller can tell exactly which items were taken.
+    std::size_t valid = 0;
+    while (valid < count && items[valid] != kEmpty &&
+           static_cast<std::uint64_t>(items[valid]) < bottom_) {
+        ++valid;
+    }
+    return detail::with_cas2_slots(slot_mode_, [&](auto slots) {
+        return enqueue_batch(valid, [&](std::uint64_t t, std::size_t i) {
+            return try_enqueue_at(slots, t, static_cast<std::uint64_t>(items[i]));
+        });
+    });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQ<T, WaitPolicy, RemapPolicy, Capacity>::dequeue_bulk(T* out, std::size_t max_count) {
+    if (out == nullptr || max_count == 0) {
+        return 0;
+    }
+    return detail::with_cas2_slots(slot_mode_, [&](auto slots) {
+        return dequeue_batch(out, max_count, kEmpty,
+                             [&](std::uint64_t h) { return try_dequeue_at(slots, h); });
+    });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+bool SCQ<T, WaitPolicy, RemapPolicy, Capacity>::is_empty() const noexcept {
+    return Tickets::ring_is_empty();
+}
+
+}  // namespace lscq
@@ -0,0 +1,374 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <lscq/detail/atomic_ptr.hpp>
+#include <lscq/detail/likely.hpp>
+#include <lscq/detail/ring_math.hpp>
+#include <lscq/detail/scq64_impl.hpp>
+#include <lscq/scqp.hpp>
+
+namespace lscq {
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+SCQP<T, WaitPolicy, RemapPolicy, Capacity>::SCQP(std::size_t scqsize, bool force_fallback,
+                                                 RingPlacement placement)
+    : Tickets(ring_size(scqsize)),
+      entries_p_(),
+      ptr_array_(),
+      alloc_ring_(),
+      free_ring_(),
+      using_fallback_(force_fallback || !lscq::has_cas2_support()),
+      slot_mode_(entry_load_mode()) {
+    static_assert(sizeof(EntryP) == 16);
+    static_assert(alignof(EntryP) == 16);
+
+    // Ring storage starts zeroed: null payloads, and cycle 0 with IsSafe set in the native slots.
+    if (using_fallback_) {
+        ptr_array_.reset(scqsize_, placement);
+
+        // Every slot starts free: fq holds 0..SCQSIZE-1, aq is empty. aq is a zeroed ring like
+        // any new SCQ64, so filling fq is the only O(n) step.
+        alloc_ring_ = std::make_unique<IndexRing>(scqsize_ * 2, placement);
+        free_ring_ = std::make_unique<IndexRing>(scqsize_ * 2, placement);
+        for (std::size_t i = 0; i < scqsize_; ++i) {
+            (void)free_ring_->enqueue(static_cast<std::uint64_t>(i));
+        }
+    } else {
+        entries_p_.reset(scqsize_, placement);
+    }
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQP<T, WaitPolicy, RemapPolicy, Capacity>::ring_size(std::size_t requested) noexcept {
+    // Power-of-two ring (SCQSIZE = 2n) of at least 4 slots, and at least one slot per remap slice.
+    return Capacity::template ring_size<(kRemapStride > 4 ? kRemapStride : 4)>(requested);
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+SCQP<T, WaitPolicy, RemapPolicy, Capacity>::~SCQP() = default;
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQP<T, WaitPolicy, RemapPolicy, Capacity>::cache_remap(
+    std::size_t idx) const noexcept {
+    // kRemapStride is a compile-time power of two: a mask, two shifts and a multiply.
+    return detail::remap_index<kRemapStride>(idx, scqsize_);
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+bool SCQP<T, WaitPolicy, RemapPolicy, Capacity>::enqueue(T* ptr) {
+    if (LSCQ_UNLIKELY(ptr == nullptr)) {
+        return false;
+    }
+    if (using_fallback_) {
+        return enqueue_index(ptr);
+    }
+    return detail::with_cas2_slots(slot_mode_, [&](auto slots) {
+        return enqueue_one([&](std::uint64_t t) { return try_enqueue_ptr_at(slots, t, ptr); });
+    });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+T* SCQP<T, WaitPolicy, RemapPolicy, Capacity>::dequeue() {
+    if (using_fallback_) {
+        return dequeue_index();
+    }
+    return detail::with_cas2_slots(slot_mode_, [&](auto slots) {
+        return dequeue_one(static_cast<T*>(nullptr),
+                           [&](std::uint64_t h) { return try_dequeue_ptr_at(slots, h); });
+    });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+template <class Slots>
+bool SCQP<T, WaitPolicy, RemapPolicy, Capacity>::try_enqueue_ptr_at(Slots slots, std::uint64_t t,
+                                                                    T* ptr) {
+    const std::uint64_t cycle_t = t >> scq_shift_;
+    const std::size_t j = cache_remap(static_cast<std::size_t>(t & bottom_));
+
+    WaitPolicy backoff;
+    while (true) {
+        const EntryP ent = slots.load(&entries_p_[j]);
+        const std::uint64_t cycle_e = unpack_cycle(ent.cycle_flags);
+
+        if (LSCQ_LIKELY(detail::cycle_less(cycle_e, cycle_t) && ent.ptr == nullptr)) {
+            const bool is_safe = unpack_is_safe(ent.cycle_flags);
+            if (LSCQ_LIKELY(is_safe || head_.load(std::memory_order_acquire) <= t)) {
+                EntryP expected = ent;
+                const EntryP desired{pack_cycle_flags(cycle_t, true), ptr};
+                // Release publishes *ptr to the dequeuer's acquire slot load.
+                if (slots.cas(&entries_p_[j], expected, desired, std::memory_order_release)) {
+                    reset_threshold_after_enqueue();
+                    return true;
+                }
+                backoff.wait();
+                continue;
+            }
+        }
+        return false;
+    }
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+template <class Slots>
+T* SCQP<T, WaitPolicy, RemapPolicy, Capacity>::try_dequeue_ptr_at(Slots slots, std::uint64_t h) {
+    const std::uint64_t cycle_h = h >> scq_shift_;
+    const std::size_t j = cache_remap(static_cast<std::size_t>(h & bottom_));
+
+    WaitPolicy backoff;
+    while (true) {
+        const EntryP ent = slots.load(&entries_p_[j]);
+        const std::uint64_t cycle_e = unpack_cycle(ent.cycle_flags);
+
+        if (LSCQ_LIKELY(cycle_e == cycle_h)) {
+            // IsSafe only gates enqueuers (Figure 8 line 18): a dequeuer from a later cycle may
+            // have cleared it while this element was still waiting for us, so consume regardless.
+            T* value = ent.ptr;
+            if (value == nullptr) {
+                return nullptr;
+            }
+
+            (void)detail::atomic_exchange_ptr(&entries_p_[j].ptr, static_cast<T*>(nullptr));
+            return value;
+        }
+
+        EntryP desired{pack_cycle_flags(cycle_e, false), ent.ptr};
+        if (ent.ptr == nullptr) {
+            desired = EntryP{pack_cycle_flags(cycle_h, unpack_is_safe(ent.cycle_flags)), nullptr};
+        }
+
+        if (detail::cycle_less(cycle_e, cycle_h)) {
+            EntryP expected = ent;
+            if (!slots.cas(&entries_p_[j], expected, desired, std::memory_order_release)) {
+                backoff.wait();
+                continue;
+            }
+        }
+        return nullptr;
+    }
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+bool SCQP<T, WaitPolicy, RemapPolicy, Capacity>::enqueue_index(T* ptr) {
+    if (LSCQ_UNLIKELY(alloc_ring_->is_finalized())) {
+        return false;
+    }
+
+    // fq empty means every slot is allocated: the queue is full.
+    const std::uint64_t idx = free_ring_->dequeue();
+    if (LSCQ_UNLIKELY(idx == IndexRing::kEmpty)) {
+        return false;
+    }
+
+    // The slot is ours until idx is published on aq; aq's CAS releases the store.
+    detail::atomic_store_ptr(&ptr_array_[idx], ptr);
+    if (LSCQ_UNLIKELY(!alloc_ring_->enqueue(idx))) {
+        // aq was finalized after the check above: give the slot back.
+        detail::atomic_store_ptr(&ptr_array_[idx], static_cast<T*>(nullptr));
+        (void)free_ring_->enqueue(idx);
+        return false;
+    }
+    return true;
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+T* SCQP<T, WaitPolicy, RemapPolicy, Capacity>::dequeue_index() {
+    const std::uint64_t idx = alloc_ring_->dequeue();
+    if (LSCQ_UNLIKELY(idx == IndexRing::kEmpty)) {
+        return nullptr;
+    }
+
+    // Clear the slot before handing idx back to fq, so reset_for_reuse sees no residual payload.
+    T* value = detail::atomic_exchange_ptr(&ptr_array_[idx], static_cast<T*>(nullptr));
+    (void)free_ring_->enqueue(idx);
+    return value;
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQP<T, WaitPolicy, RemapPolicy, Capacity>::enqueue_bulk_index(T* const* ptrs,
+                                                                           std::size_t count) {
+    std::uint64_t indices[kIndexBatch];
+    std::size_t placed = 0;
+    while (placed < count && !alloc_ring_->is_finalized()) {
+        std::size_t want = count - placed;
+        if (want > kIndexBatch) {
+            want = kIndexBatch;
+        }
+
+        // One Head claim on fq and one Tail claim on aq per round.
+        const std::size_t got = free_ring_->dequeue_bulk(indices, want);
+        if (got == 0) {
+            break;  // Full.
+        }
+        for (std::size_t i = 0; i < got; ++i) {
+            detail::atomic_store_ptr(&ptr_array_[indices[i]], ptrs[placed + i]);
+        }
+        const std::size_t published = alloc_ring_->enqueue_bulk(indices, got);
+        placed += published;
+        if (LSCQ_UNLIKELY(published != got)) {
+            // aq was finalized mid-batch: give the unpublished slots back.
+            for (std::size_t i = published; i < got; ++i) {
+                detail::atomic_store_ptr(&ptr_array_[indices[i]], static_cast<T*>(nullptr));
+            }
+            (void)free_ring_->enqueue_bulk(indices + published, got - published);
+            break;
+        }
+    }
+    return placed;
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQP<T, WaitPolicy, RemapPolicy, Capacity>::dequeue_bulk_index(T** out,
+                                                                           std::size_t max_count) {
+    std::uint64_t indices[kIndexBatch];
+    std::size_t got = 0;
+    while (got < max_count) {
+        std::size_t want = max_count - got;
+        if (want > kIndexBatch) {
+            want = kIndexBatch;
+        }
+
+        const std::size_t n = alloc_ring_->dequeue_bulk(indices, want);
+        if (n == 0) {
+            break;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            out[got + i] =
+                detail::atomic_exchange_ptr(&ptr_array_[indices[i]], static_cast<T*>(nullptr));
+        }
+        (void)free_ring_->enqueue_bulk(indices, n);
+        got += n;
+    }
+    return got;
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQP<T, WaitPolicy, RemapPolicy, Capacity>::enqueue_bulk(T* const* ptrs,
+                                                                     std::size_t count) {
+    if (ptrs == nullptr) {
+        return 0;
+    }
+
+    // Only the non-null prefix is enqueued, so the caller can tell exactly which items were taken.
+    std::size_t valid = 0;
+    while (valid < count && ptrs[valid] != nullptr) {
+        ++valid;
+    }
+    if (using_fallback_) {
+        return enqueue_bulk_index(ptrs, valid);
+    }
+    return detail::with_cas2_slots(slot_mode_, [&](auto slots) {
+        return enqueue_batch(valid, [&](std::uint64_t t, std::size_t i) {
+            return try_enqueue_ptr_at(slots, t, ptrs[i]);
+        });
+    });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQP<T, WaitPolicy, RemapPolicy, Capacity>::dequeue_bulk(T** out,
+                                                                     std::size_t max_count) {
+    if (out == nullptr || max_count == 0) {
+        return 0;
+    }
+    if (using_fallback_) {
+        return dequeue_bulk_index(out, max_count);
+    }
+    return detail::with_cas2_slots(slot_mode_, [&](auto slots) {
+        return dequeue_batch(out, max_count, static_cast<T*>(nullptr),
+                             [&](std::uint64_t h) { return try_dequeue_ptr_at(slots, h); });
+    });
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+bool SCQP<T, WaitPolicy, RemapPolicy, Capacity>::is_empty() const noexcept {
+    if (using_fallback_) {
+        return alloc_ring_->is_empty();
+    }
+    return Tickets::ring_is_empty();
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+std::size_t SCQP<T, WaitPolicy, RemapPolicy, Capacity>::size_approx() const noexcept {
+    if (using_fallback_) {
+        return alloc_ring_->size_approx();
+    }
+    return Tickets::ring_size_approx();
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+void SCQP<T, WaitPolicy, RemapPolicy, Capacity>::finalize() noexcept {
+    if (using_fallback_) {
+        alloc_ring_->finalize();
+        return;
+    }
+    Tickets::finalize_tail();
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+bool SCQP<T, WaitPolicy, RemapPolicy, Capacity>::is_finalized() const noexcept {
+    if (using_fallback_) {
+        return alloc_ring_->is_finalized();
+    }
+    return Tickets::tail_is_finalized();
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+void SCQP<T, WaitPolicy, RemapPolicy, Capacity>::reset_threshold() noexcept {
+    if (using_fallback_) {
+        alloc_ring_->reset_threshold();
+        return;
+    }
+    Tickets::reset_threshold();
+}
+
+template <class T, class WaitPolicy, class RemapPolicy, class Capacity>
+bool SCQP<T, WaitPolicy, RemapPolicy, Capacity>::reset_for_reuse() noexcept {
+    // Contract: only call when empty and with exclusive access (no concurrent enqueue/dequeue).
+    // A finalized ring counts as drained even with Tail ahead of Head: a producer that passed the
+    // pre-check before FINALIZE may still take a ticket afterwards, and such tickets never write
+    // a slot. The rebase below (and SCQ64::reopen in the fallback) skips them.
+    if (!is_empty() && !is_finalized()) {
+        assert(false && "SCQP::reset_for_reuse requires an empty queue with no concurrent users");
+        return false;
+    }
+
+#ifndef NDEBUG
+    // A drained queue never keeps a payload; only debug builds pay for a pass to confirm it.
+    for (std::size_t i = 0; i < scqsize_; ++i) {
+        const T* residual = using_fallback_ ? ptr_array_[i] : entries_p_[i].ptr;
+        if (residual != nullptr) {
+            assert(false &&
+                   "SCQP::reset_for_reuse requires all slots empty (no residual payloads)");
+            return false;
+        }
+    }
+#endif
+
+    const std::uint64_t scqsize_u64 = static_cast<std::uint64_t>(scqsize_);
+
+    // A drained fallback queue already has every index back in fq and none in aq, which is all
+    // a fresh one guarantees (the order of free indices is irrelevant), so its rings are kept.
+    //
+    // The native ring keeps its slots as well. Every ticket below max(Head, Tail) has been
+    // consumed or skipped, so each slot holds a cycle below that of the next cycle boundary and
+    // no payload. Restarting Head and Tail on that boundary makes all of them read as "older
+    // cycle, empty", which is exactly what enqueue expects of a freshly constructed slot.
+    std::uint64_t base = scqsize_u64;
+    if (using_fallback_) {
+        alloc_ring_->reopen();
+    } else {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        const std::uint64_t tail = detail::tail_ticket(tail_.load(std::memory_order_relaxed));
+        const std::uint64_t used = head > tail ? head : tail;
+        base = (used + scqsize_u64 - 1u) / scqsize_u64 * scqsize_u64;
+    }
+
+    head_.store(base, std::memory_order_relaxed);
+    tail_.store(base, std::memory_order_relaxed);
+    Tickets::reset_threshold();
+    return true;
+}
+
+}  // namespace lscq
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace lscq::detail {
+
+/**
+ * @brief Process-wide dense id of the calling thread, assigned on first use.
+ *
+ * Ids are handed out round-robin so that the first @c N threads touching any ShardedQueue with
+ * @c N lanes land on distinct home lanes (and on distinct LSCQ active-operation shards).
+ */
+inline std::size_t sharded_thread_id() noexcept {
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t id = next.fetch_add(1, std::memory_order_relaxed);
+    return id;
+}
+
+}  // namespace lscq::detail
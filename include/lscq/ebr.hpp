@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <lscq/config.hpp>
 #include <mutex>
 #include <vector>
 
@@ -172,7 +173,7 @@ class EBRManager {
 
     static constexpr std::size_t kNumGenerations = 3;
 
-    alignas(64) std::atomic<std::uint64_t> global_epoch_{0};
+    alignas(config::CACHE_LINE_SIZE) std::atomic<std::uint64_t> global_epoch_{0};
 
     mutable std::mutex retired_mutex_;
     std::vector<RetiredNode> retired_[kNumGenerations];
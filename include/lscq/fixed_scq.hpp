@@ -0,0 +1,73 @@
+/**
+ * @file fixed_scq.hpp
+ * @brief FixedSCQ: SCQ with a compile-time ring size and an inline ring.
+ * @author lscq contributors
+ * @version 0.1.0
+ *
+ * FixedSCQ is @ref SCQ on FixedCapacity<N> (see capacity.hpp): the same algorithm body, with
+ * SCQSIZE a template parameter. The cycle shift, index mask, threshold reset value and
+ * cache_remap fold into constants, and the ring lives inside the queue object instead of behind a
+ * heap pointer.
+ */
+
+#ifndef LSCQ_FIXED_SCQ_HPP_
+#define LSCQ_FIXED_SCQ_HPP_
+
+#include <cstddef>
+#include <lscq/cache_remap.hpp>
+#include <lscq/capacity.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/wait_policy.hpp>
+
+// The library build only pre-instantiates DynamicCapacity queues.
+#include <lscq/detail/scq_impl.hpp>
+
+namespace lscq {
+
+/**
+ * @class FixedSCQ
+ * @brief Scalable Circular Queue (SCQ) whose ring size is fixed at compile time.
+ *
+ * Behaves exactly like SCQ<T, WaitPolicy> constructed with @p N: same value domain (values below
+ * N - 1), same usable capacity (N / 2), and the same full-ring behaviour (enqueue spins).
+ *
+ * @tparam T Value type stored in the queue (must be an unsigned integral type)
+ * @tparam N Ring size (SCQSIZE = 2n). Must be a power of two and at least 4.
+ * @tparam WaitPolicy What a thread does between retries of a lost CAS or abandoned ticket (see
+ * wait_policy.hpp)
+ *
+ * Thread-safety: @ref enqueue, @ref dequeue, and @ref is_empty are safe for concurrent callers.
+ *
+ * @note The object holds N 16-byte entries inline. Allocate large rings on the heap (e.g. with
+ * std::make_unique) rather than on the stack.
+ *
+ * Example:
+ * @code
+ * auto q = std::make_unique<lscq::FixedSCQ<std::uint32_t, 1024>>();
+ * q->enqueue(1);
+ * const auto v = q->dequeue();
+ * @endcode
+ */
+template <class T, std::size_t N, class WaitPolicy = DefaultWaitPolicy>
+class FixedSCQ : public SCQ<T, WaitPolicy, DefaultRemap, FixedCapacity<N>> {
+   public:
+    /** @brief Ring size (SCQSIZE = 2n). */
+    static constexpr std::size_t kScqSize = N;
+    /** @brief Usable capacity (QSIZE = n). */
+    static constexpr std::size_t kQSize = N / 2;
+
+    /**
+     * @brief Construct an empty queue.
+     * @note Thread-safe: construction must complete before the queue is shared with other threads.
+     */
+    FixedSCQ() : SCQ<T, WaitPolicy, DefaultRemap, FixedCapacity<N>>(N) {}
+
+    /** @brief Return the ring size (SCQSIZE = 2n). */
+    static constexpr std::size_t scqsize() noexcept { return kScqSize; }
+    /** @brief Return the usable capacity (QSIZE = n). */
+    static constexpr std::size_t qsize() noexcept { return kQSize; }
+};
+
+}  // namespace lscq
+
+#endif  // LSCQ_FIXED_SCQ_HPP_
@@ -0,0 +1,70 @@
+/**
+ * @file fixed_scqp.hpp
+ * @brief FixedSCQP: SCQP with a compile-time ring size and an inline ring.
+ * @author lscq contributors
+ * @version 0.1.0
+ *
+ * FixedSCQP is @ref SCQP on FixedCapacity<N> (see capacity.hpp): the same algorithm body, with
+ * SCQSIZE a template parameter. The cycle of a ticket is a constant shift, the index mask,
+ * threshold reset value and cache_remap are compile-time constants, and the CAS2 ring lives inside
+ * the queue object.
+ */
+
+#ifndef LSCQ_FIXED_SCQP_HPP_
+#define LSCQ_FIXED_SCQP_HPP_
+
+#include <cstddef>
+#include <lscq/cache_remap.hpp>
+#include <lscq/capacity.hpp>
+#include <lscq/scqp.hpp>
+#include <lscq/wait_policy.hpp>
+
+// The library build only pre-instantiates DynamicCapacity queues.
+#include <lscq/detail/scqp_impl.hpp>
+
+namespace lscq {
+
+/**
+ * @class FixedSCQP
+ * @brief SCQP whose ring size is fixed at compile time.
+ *
+ * Same API and full/empty behaviour as SCQP<T, WaitPolicy> constructed with @p N: @ref enqueue
+ * returns false when N pointers are queued, @ref dequeue returns nullptr when empty. Without
+ * CMPXCHG16B (or with @p force_fallback) it runs SCQP's lock-free index-ring fallback, whose
+ * pointer slots and index rings are allocated as for SCQP.
+ *
+ * @tparam T Pointee type. The queue stores pointers to T (T*).
+ * @tparam N Ring size (SCQSIZE = 2n). Must be a power of two and at least 4.
+ * @tparam WaitPolicy What a thread does between retries of a lost CAS or abandoned ticket (see
+ * wait_policy.hpp).
+ *
+ * Thread-safety: @ref enqueue, @ref dequeue, and @ref is_empty are safe for concurrent callers.
+ *
+ * @note The object holds N 16-byte entries inline. Allocate large rings on the heap (e.g. with
+ * std::make_unique) rather than on the stack.
+ */
+template <class T, std::size_t N, class WaitPolicy = DefaultWaitPolicy>
+class FixedSCQP : public SCQP<T, WaitPolicy, DefaultRemap, FixedCapacity<N>> {
+   public:
+    /** @brief Ring size (SCQSIZE = 2n). */
+    static constexpr std::size_t kScqSize = N;
+    /** @brief Usable capacity (QSIZE = n). */
+    static constexpr std::size_t kQSize = N / 2;
+
+    /**
+     * @brief Construct an empty queue.
+     * @param force_fallback If true, forces the index-ring fallback even if CAS2 is available.
+     * @note Thread-safe: construction must complete before the queue is shared with other threads.
+     */
+    explicit FixedSCQP(bool force_fallback = false)
+        : SCQP<T, WaitPolicy, DefaultRemap, FixedCapacity<N>>(N, force_fallback) {}
+
+    /** @brief Return the ring size (SCQSIZE = 2n). */
+    static constexpr std::size_t scqsize() noexcept { return kScqSize; }
+    /** @brief Return the usable capacity (QSIZE = n). */
+    static constexpr std::size_t qsize() noexcept { return kQSize; }
+};
+
+}  // namespace lscq
+
+#endif  // LSCQ_FIXED_SCQP_HPP_
@@ -5,46 +5,114 @@
  * @version 0.1.0
  *
  * LSCQ is an unbounded multi-producer multi-consumer (MPMC) queue that chains multiple bounded
- * SCQP nodes. When the tail node becomes full, a new node is allocated and linked. When the head
- * node is drained, it is returned to an internal ObjectPool for reuse.
+ * SCQP nodes. When the tail node becomes full, it is finalized and a new node is allocated and
+ * linked. When the head node is drained, it is returned to a node pool for reuse once no thread
+ * can still be operating on it. Nodes can start small and grow geometrically (LSCQNodeSizing), and
+ * the node pool can be shared by many queues, which keeps idle queues cheap.
  */
 
 #ifndef LSCQ_LSCQ_HPP_
 #define LSCQ_LSCQ_HPP_
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <lscq/config.hpp>
-#include <lscq/object_pool.hpp>
+#include <lscq/detail/thread_id.hpp>
+#include <lscq/placement.hpp>
+#include <lscq/pool_policy.hpp>
 #include <lscq/scqp.hpp>
+#include <lscq/wait_policy.hpp>
+#include <memory>
 
 namespace lscq {
 
 class EBRManager;  // Legacy (backward-compat) constructor overload only.
 
+/**
+ * @brief Ring sizes of the SCQP nodes an LSCQ links.
+ *
+ * The first node gets @ref initial_scqsize slots. Each successor linked when the tail node fills
+ * gets twice the slots of the node it follows, up to @ref max_scqsize, so a queue that stays short
+ * only ever holds a small ring while a growing backlog quickly reaches full-size nodes. Nodes do
+ * not shrink again; drained large nodes go back to the node pool, where the next extension of the
+ * same size (on this or, with a shared pool, another queue) picks them up.
+ *
+ * Both sizes are rounded the way SCQP rounds its ring size.
+ *
+ * With @ref stage_successor_at_percent set, the tail node's successor is allocated ahead of time:
+ * the first enqueue that finds the node filled to the watermark takes the successor from the pool
+ * (allocating it on a miss) and stages it on the node, unlinked. When the node does fill up, the
+ * extending producer only has to fill and link the staged node, so no producer allocates while the
+ * others wait for the link. LSCQ::stage_successor does the same on demand, e.g. from a
+ * housekeeping thread.
+ *
+ * Example:
+ * @code
+ * // 256-byte first ring instead of 1 MiB, doubling up to the default node size.
+ * lscq::LSCQ<Msg> q(lscq::LSCQNodeSizing::growing());
+ *
+ * // Full-size nodes; each successor is prepared once its predecessor is 75% full.
+ * lscq::LSCQ<Msg> r(lscq::LSCQNodeSizing::fixed(4096).with_staged_successor());
+ * @endcode
+ */
+struct LSCQNodeSizing {
+    /** @brief Ring size of the first node. */
+    std::size_t initial_scqsize = config::DEFAULT_SCQSIZE;
+    /** @brief Largest ring size a successor node grows to. */
+    std::size_t max_scqsize = config::DEFAULT_SCQSIZE;
+    /**
+     * @brief Fill level (percent of the ring, 1-100) at which a node's successor is staged; 0
+     * (default) stages none, leaving the allocation to the producer that finds the node full.
+     */
+    unsigned stage_successor_at_percent = 0;
+
+    /** @brief Every node has @p scqsize slots (the classic LSCQ layout). */
+    static constexpr LSCQNodeSizing fixed(std::size_t scqsize) noexcept {
+        return {scqsize, scqsize};
+    }
+    /** @brief Start at @p initial slots and double per linked node up to @p max. */
+    static constexpr LSCQNodeSizing growing(std::size_t initial = config::LSCQ_SMALL_SCQSIZE,
+                                            std::size_t max = config::DEFAULT_SCQSIZE) noexcept {
+        return {initial, max};
+    }
+    /** @brief This sizing, staging each successor once a node is @p fill_percent full. */
+    constexpr LSCQNodeSizing with_staged_successor(unsigned fill_percent = 75) const noexcept {
+        LSCQNodeSizing sizing = *this;
+        sizing.stage_successor_at_percent = fill_percent;
+        return sizing;
+    }
+};
+
 /**
  * @class LSCQ
  * @brief Linked Scalable Circular Queue (LSCQ): unbounded MPMC queue storing pointers.
  *
  * LSCQ is an unbounded multi-producer multi-consumer (MPMC) queue that chains
- * multiple SCQP nodes together. When a node becomes full, a new node is created
- * and linked to the tail. Empty nodes at the head are returned to an internal ObjectPool for
- * reuse.
+ * multiple SCQP nodes together. When a node becomes full, it is finalized (SCQP::finalize) and a
+ * new node is created and linked to the tail. Empty nodes at the head are retired and returned to
+ * the queue's NodePool after a grace period, i.e. once every operation that could still hold
+ * them has finished (epoch-based reclamation, see retire_nodes()).
  *
  * Key features:
  * - Unbounded capacity (grows dynamically)
  * - Lock-free operations (enqueue/dequeue)
- * - Node recycling via ObjectPool
+ * - Node recycling via NodePool, protected by a per-queue epoch scheme
+ * - Optional small first node with geometric growth (LSCQNodeSizing) and node pools shared
+ *   across queues, for programs that keep many mostly idle queues
  * - Cache-line aligned to minimize false sharing
  *
  * @tparam T Pointee type. The queue stores pointers to T (T*).
+ * @tparam WaitPolicy Passed to every SCQP node (see wait_policy.hpp). LSCQ itself never waits for
+ * another thread: node linking is non-blocking.
+ * @tparam PoolPolicy Object pool that recycles nodes (see pool_policy.hpp).
  *
  * Thread-safety: @ref enqueue and @ref dequeue are safe for concurrent calls by multiple producers
  * and consumers.
  *
  * Complexity:
- * - @ref enqueue / @ref dequeue - O(1) expected (may allocate when extending; may spin/yield under
+ * - @ref enqueue / @ref dequeue - O(1) expected (may allocate when extending; may spin under
  * contention)
  *
  * @note The queue stores raw pointers and does not manage the lifetime of the pointee objects.
@@ -58,52 +126,172 @@ class EBRManager;  // Legacy (backward-compat) constructor overload only.
  *     // use *p ...
  *     delete p;
  * }
+ *
+ * // One queue per connection: small growing nodes, recycled through one shared pool.
+ * using Queue = lscq::LSCQ<Msg>;
+ * auto pool = std::make_shared<Queue::NodePool>(lscq::LSCQNodeSizing::growing());
+ * Queue per_connection(pool);
  * @endcode
  */
-template <class T>
+template <class T, class WaitPolicy = DefaultWaitPolicy, class PoolPolicy = DefaultPoolPolicy>
 class LSCQ {
    public:
     /**
      * @brief Internal node containing an SCQP ring plus linkage metadata.
      *
-     * Each node is cache-line aligned (64 bytes) to prevent false sharing.
-     * The next pointer and finalized flag each occupy their own cache line
-     * to avoid contention during concurrent enqueue/dequeue operations.
+     * Each node is cache-line aligned (64 bytes) to prevent false sharing. The next pointer
+     * occupies its own cache line to avoid contention with the ring's Head/Tail. Whether the node
+     * is full lives in the ring itself (SCQP::finalize), so no enqueue can land in a node after
+     * its successor has been linked.
      *
      * @note This is an implementation detail exposed as a public nested type for template linkage.
      */
-    struct alignas(64) Node {
+    struct alignas(config::CACHE_LINE_SIZE) Node {
         /** @brief Embedded bounded ring storing user pointers. */
-        SCQP<T> scqp;
+        SCQP<T, WaitPolicy> scqp;
 
         /** @brief Next node in the linked list (published by enqueue when extending). */
-        alignas(64) std::atomic<Node*> next;
-        /** @brief Set to true once this node is considered full and a successor is linked. */
-        alignas(64) std::atomic<bool> finalized;
+        alignas(config::CACHE_LINE_SIZE) std::atomic<Node*> next;
+
+        /** @brief Link in a shard's limbo list while the node waits out its grace period. */
+        Node* limbo_next;
+
+        /** @brief Reclamation epoch observed right after the node was unlinked from head_. */
+        std::uint64_t retire_epoch;
+
+        /**
+         * @brief Successor prepared ahead of time (see LSCQNodeSizing::stage_successor_at_percent),
+         * or nullptr / one of LSCQ's staging markers. Never visible to other producers.
+         */
+        std::atomic<Node*> staged;
+
+        /** @brief Fill level (in elements) at which enqueue stages a successor; 0 = never. */
+        std::size_t stage_at;
 
         /**
          * @brief Construct a new Node with the given SCQP size
          *
          * @param scqsize Size of the embedded SCQP
+         * @param placement NUMA placement of the embedded SCQP ring
          *
          * @note Construction must complete before the node is published to other threads.
          */
-        explicit Node(std::size_t scqsize);
+        explicit Node(std::size_t scqsize, RingPlacement placement = {});
+    };
+
+    /**
+     * @brief Recycler for LSCQ nodes, with one PoolPolicy object pool per node size.
+     *
+     * Node sizes are the powers of two from the sizing's initial to its max scqsize. The pool of
+     * a size class is only created when the first node of that size is returned, so an idle
+     * queue (and a class nobody uses) costs no pool shards. Several queues can share
+     * one NodePool through std::shared_ptr: a node drained by one queue is reused by whichever
+     * queue extends next, and the pool outlives the last queue holding it.
+     *
+     * Thread-safety: all methods are safe for concurrent calls.
+     */
+    class NodePool {
+       public:
+        /**
+         * @brief Construct an empty pool.
+         *
+         * @param sizing Node sizes served by the pool; queues built on it use this sizing.
+         * @param placement NUMA placement of newly allocated node rings (see LSCQ's constructor).
+         * @param shard_count Shards of each size class's pool; 0 picks the pools' default of two
+         * per hardware thread.
+         */
+        explicit NodePool(LSCQNodeSizing sizing = {},
+                          RingPlacement placement = RingPlacement::local(),
+                          std::size_t shard_count = 0);
+        ~NodePool();
+
+        NodePool(const NodePool&) = delete;
+        NodePool& operator=(const NodePool&) = delete;
+        NodePool(NodePool&&) = delete;
+        NodePool& operator=(NodePool&&) = delete;
+
+        /**
+         * @brief Get an empty, unlinked node with an @p scqsize slot ring.
+         *
+         * Recycled nodes are reset for reuse; on a miss a new node is allocated.
+         *
+         * @throws std::bad_alloc If allocating a new node fails.
+         */
+        Node* Get(std::size_t scqsize);
+
+        /** @brief Return a node no thread can reach any more. `nullptr` is ignored. */
+        void Put(Node* node);
+
+        /** @brief Return several nodes, taking each size class's shard lock once per run. */
+        void PutBatch(Node** nodes, std::size_t count);
+
+        /** @brief Delete every node currently stored in the pool. */
+        void Clear();
+
+        /** @brief Number of nodes currently stored (approximate under concurrency). */
+        std::size_t Size() const;
+
+        /**
+         * @brief Sizing of the pool, rounded to the ring sizes SCQP actually allocates (and the
+         * staging watermark clamped to 100).
+         */
+        const LSCQNodeSizing& sizing() const noexcept { return sizing_; }
+
+       private:
+        using ClassPool = typename PoolPolicy::template pool_type<Node, WaitPolicy>;
+
+        // Size class of a rounded ring size, or class_count_ if the pool does not serve it.
+        std::size_t class_of(std::size_t scqsize) const noexcept;
+        // Pool of `size_class`, created on first use.
+        ClassPool& class_pool(std::size_t size_class);
+
+        LSCQNodeSizing sizing_;
+        RingPlacement placement_;
+        std::size_t shard_count_;
+        std::size_t class_count_;
+        std::unique_ptr<std::atomic<ClassPool*>[]> classes_;
     };
 
     /**
      * @brief Construct an LSCQ with the given SCQP size
      *
      * @param scqsize Size of each SCQP node (default: config::DEFAULT_SCQSIZE)
+     * @param placement NUMA placement of each node's ring. The default, RingPlacement::local(),
+     * puts a freshly allocated node on the NUMA node of the thread that links it (or, for the
+     * initial node, of the constructing thread). Recycled nodes keep their original placement.
+     *
+     * @throws std::bad_alloc If allocating the initial node fails.
+     */
+    explicit LSCQ(std::size_t scqsize = config::DEFAULT_SCQSIZE,
+                  RingPlacement placement = RingPlacement::local());
+
+    /**
+     * @brief Construct an LSCQ whose nodes follow @p sizing, with a node pool of its own.
+     *
+     * @param sizing First-node size and growth cap (see LSCQNodeSizing).
+     * @param placement NUMA placement of each node's ring, as above.
+     *
+     * With a growing sizing the private pool uses a single shard per size class, since such a
+     * queue is expected to be one of many; share a NodePool to pool nodes across them instead.
+     *
+     * @throws std::bad_alloc If allocating the initial node fails.
+     */
+    explicit LSCQ(LSCQNodeSizing sizing, RingPlacement placement = RingPlacement::local());
+
+    /**
+     * @brief Construct an LSCQ that takes its nodes from, and returns them to, a shared pool.
+     *
+     * @param pool Node pool, possibly shared with other queues (must not be null). The queue uses
+     * the pool's sizing and placement and keeps the pool alive until it is destroyed.
      *
      * @throws std::bad_alloc If allocating the initial node fails.
      */
-    explicit LSCQ(std::size_t scqsize = config::DEFAULT_SCQSIZE);
+    explicit LSCQ(std::shared_ptr<NodePool> pool);
 
     /**
      * @brief Backward-compatible constructor overload.
      *
-     * The EBR parameter is ignored. Node memory management is handled internally via ObjectPool.
+     * The EBR parameter is ignored. Node memory management is handled by the node pool.
      */
     explicit LSCQ(EBRManager& ebr, std::size_t scqsize = config::DEFAULT_SCQSIZE);
 
@@ -123,14 +311,13 @@ class LSCQ {
     /**
      * @brief Enqueue a pointer to the queue
      *
-     * This operation is lock-free and thread-safe. If the current tail node
-     * is full, a new node will be created and linked to the tail.
+     * This operation is lock-free and thread-safe. If the current tail node is full, it is
+     * finalized and a new node already holding @p ptr is linked after it; a thread that loses the
+     * link race recycles its node and retries on the winner's.
      *
      * @param ptr Pointer to enqueue (must not be nullptr).
-     * @return true if the pointer was successfully enqueued, false otherwise
-     *
-     * @note Returns false if @p ptr is null, or if an internal retry limit is hit under extreme
-     * contention.
+     * @return true if the pointer was enqueued; false only if @p ptr is null or the queue is being
+     * destroyed.
      */
     bool enqueue(T* ptr);
 
@@ -139,26 +326,130 @@ class LSCQ {
      *
      * This operation is lock-free and thread-safe. If the current head node
      * is empty, it will attempt to advance to the next node (if available).
-     * Empty nodes are returned to an internal ObjectPool for reuse.
+     * Empty nodes are retired and return to the node pool once no other operation can
+     * still be using them.
      *
-     * @return Pointer dequeued from the queue, or nullptr if the queue is empty (or if a bounded
-     *         internal wait limit is hit while observing a finalized-but-not-yet-linked node).
+     * @return Pointer dequeued from the queue, or nullptr if the queue is empty.
      */
     T* dequeue();
 
+    /**
+     * @brief Enqueue a batch of pointers.
+     *
+     * Built on SCQP::enqueue_bulk: each node receives as many pointers as it has room for with one
+     * ticket claim, and the batch continues on the next node once the tail node is finalized. The
+     * active-operation guard is taken once for the whole batch.
+     *
+     * @param ptrs Pointers to enqueue, in order.
+     * @param count Number of pointers in @p ptrs.
+     * @return Number of pointers enqueued. Stops at the first nullptr, so the result is a prefix
+     * length of @p ptrs.
+     */
+    std::size_t enqueue_bulk(T* const* ptrs, std::size_t count);
+
+    /**
+     * @brief Dequeue up to @p max_count pointers, walking across node boundaries.
+     *
+     * Built on SCQP::dequeue_bulk. When the head node runs dry and has a successor, the batch
+     * advances head_ to the next node and keeps draining. Nodes unlinked along the way are retired
+     * in one call at the end of the batch, and the active-operation guard is taken once.
+     *
+     * @param out Output buffer with room for at least @p max_count pointers.
+     * @param max_count Maximum number of pointers to dequeue.
+     * @return Number of pointers written to @p out (0 if the queue is empty).
+     */
+    std::size_t dequeue_bulk(T** out, std::size_t max_count);
+
+    /**
+     * @brief Prepare the current tail node's successor now, ahead of the node filling up.
+     *
+     * Takes the node from the pool (allocating it on a miss) and stages it on the tail node, so
+     * the producer that later finds the node full only fills and links it. Queues whose sizing sets
+     * a staging watermark do this from enqueue; without one, a housekeeping thread can call this
+     * periodically to keep allocation off the producers entirely.
+     *
+     * @return true if this call staged a node; false if the tail node already has one (or another
+     * thread is staging it), is being extended, or the queue is being destroyed.
+     * @throws std::bad_alloc If allocating the node fails.
+     */
+    bool stage_successor();
+
    private:
-    alignas(64) std::atomic<Node*> head_;  // Head of the linked list
-    alignas(64) std::atomic<Node*> tail_;  // Tail of the linked list
+    // Finalize the full node `tail` and try to link a fresh successor (twice its size, up to the
+    // sizing's cap) that already holds ptrs[0, count). Returns how many of them the linked node
+    // carries: 0 if another thread linked first (the caller then retries on that node).
+    std::size_t extend_tail(Node* tail, T* const* ptrs, std::size_t count);
+    // Ring size of the node that follows `tail`.
+    std::size_t successor_scqsize(const Node* tail) const noexcept {
+        return std::min(tail->scqp.scqsize() * 2, pool_->sizing().max_scqsize);
+    }
+    // Take a successor for `tail` from the pool and stage it, unless one is staged already or
+    // `tail` is being extended. Returns true if this call staged it.
+    bool try_stage_successor(Node* tail);
+    // Called after an enqueue into `tail`: stage its successor once the node has reached its
+    // watermark. Allocation failures are left to the extension itself.
+    void stage_successor_if_due(Node* tail) noexcept;
+    // Markers in Node::staged: a thread is taking a node for it, and the node is being (or has
+    // been) extended, so nothing may be staged on it any more.
+    static Node* staging_marker() noexcept { return reinterpret_cast<Node*>(std::uintptr_t{1}); }
+    static Node* consumed_marker() noexcept { return reinterpret_cast<Node*>(std::uintptr_t{2}); }
+    static bool is_staged_node(const Node* staged) noexcept {
+        return staged != nullptr && staged != staging_marker() && staged != consumed_marker();
+    }
+    // Advance head_ from the drained node `head` to `next`. Returns true if this call unlinked
+    // it, in which case the caller must retire it.
+    bool unlink_head(Node* head, Node* next);
 
-    // Destructor-safety: prevent node reclamation while operations are active.
-    alignas(64) std::atomic<int> active_ops_{0};
-    alignas(64) std::atomic<bool> closing_{false};
+    alignas(config::CACHE_LINE_SIZE) std::atomic<Node*> head_;  // Head of the linked list
+    alignas(config::CACHE_LINE_SIZE) std::atomic<Node*> tail_;  // Tail of the linked list
 
-    std::size_t scqsize_;     // Size of each SCQP node
-    ObjectPool<Node> pool_;   // Node allocator/recycler (replaces EBR for LSCQ nodes)
+    // Operation tracking, for both destructor-safety and node reclamation. Each thread counts its
+    // operations on the shard of its dense thread id, so with up to kActiveOpsShards threads no
+    // counter line is written by two of them, and closing_/epoch_ are read-mostly.
+    //
+    // An operation counts itself under the parity of the epoch_ it read on entry; that increment
+    // is the whole per-operation cost of reclamation. epoch_ only advances from e to e + 1 once
+    // no shard has an operation left under the parity of e - 1, so a node retired in epoch e can
+    // still be reached by an operation that entered no later than e, and every such operation
+    // has left by the time epoch_ reaches e + kReclaimLag. Retired nodes wait in the limbo list
+    // of the retiring thread's shard until then. The destructor waits for every shard to drain.
+    static constexpr std::size_t kActiveOpsShards = 32;
+    static constexpr std::uint64_t kReclaimLag = 3;
+    struct alignas(config::CACHE_LINE_SIZE) ActiveOpsShard {
+        std::atomic<int> count[2] = {0, 0};  // Operations in flight, by epoch parity
+        std::atomic<Node*> limbo{nullptr};   // Retired nodes waiting for their grace period
+    };
+    ActiveOpsShard& active_ops_shard() noexcept {
+        return active_ops_[detail::sharded_thread_id() & (kActiveOpsShards - 1)];
+    }
+    std::atomic<int>& enter_epoch() noexcept {
+        // seq_cst: the epoch read must not see a later epoch than the retirements it overlaps.
+        const std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+        return active_ops_shard().count[epoch & 1u];
+    }
+
+    // Hand nodes unlinked from head_ to the calling thread's limbo list, then recycle the limbo
+    // nodes whose grace period has ended. `own_count` is the caller's enter_epoch() counter.
+    void retire_nodes(Node* const* nodes, std::size_t count, const std::atomic<int>& own_count);
+    // Return the nodes in `shard`'s limbo list that no operation can reach any more to the pool.
+    void reclaim_limbo(ActiveOpsShard& shard);
+    // Bump epoch_ if no operation is left under the parity of the previous epoch, not counting
+    // one operation on `quiescent` (a caller that holds no node pointer). Returns false if an
+    // operation still holds it back.
+    bool try_advance_epoch(const std::atomic<int>* quiescent) noexcept;
+
+    ActiveOpsShard active_ops_[kActiveOpsShards];
+    alignas(config::CACHE_LINE_SIZE) std::atomic<std::uint64_t> epoch_{0};
+    alignas(config::CACHE_LINE_SIZE) std::atomic<bool> closing_{false};
+
+    std::shared_ptr<NodePool> pool_;  // Node allocator/recycler, possibly shared between queues
     EBRManager* legacy_ebr_;  // Optional legacy pointer (unused; kept for backward compatibility)
 };
 
 }  // namespace lscq
 
+#if LSCQ_HEADER_ONLY
+#include <lscq/detail/lscq_impl.hpp>
+#endif
+
 #endif  // LSCQ_LSCQ_HPP_
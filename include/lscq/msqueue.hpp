@@ -13,6 +13,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <lscq/config.hpp>
 #include <new>
 
 namespace lscq {
@@ -93,14 +94,20 @@ class MSQueue {
     void delete_chain(Node* first) noexcept;
     void delete_retired() noexcept;
 
-    alignas(64) std::atomic<Node*> head_;
-    alignas(64) std::atomic<Node*> tail_;
-    alignas(64) std::atomic<Node*> retired_;
+    alignas(config::CACHE_LINE_SIZE) std::atomic<Node*> head_;
+    alignas(config::CACHE_LINE_SIZE) std::atomic<Node*> tail_;
+    alignas(config::CACHE_LINE_SIZE) std::atomic<Node*> retired_;
 };
 
+#if !LSCQ_HEADER_ONLY
 extern template class MSQueue<std::uint64_t>;
 extern template class MSQueue<std::uint32_t>;
+#endif
 
 }  // namespace lscq
 
+#if LSCQ_HEADER_ONLY
+#include <lscq/detail/msqueue_impl.hpp>
+#endif
+
 #endif  // LSCQ_MSQUEUE_HPP_
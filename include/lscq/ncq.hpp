@@ -15,8 +15,12 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <lscq/cache_remap.hpp>
 #include <lscq/cas2.hpp>
 #include <lscq/config.hpp>
+#include <lscq/detail/ring_storage.hpp>
+#include <lscq/placement.hpp>
+#include <lscq/wait_policy.hpp>
 #include <memory>
 #include <new>
 #include <type_traits>
@@ -31,6 +35,9 @@ namespace lscq {
  * paper (Figure 5).
  *
  * @tparam T Value type stored in the queue (must be an unsigned integral type)
+ * @tparam WaitPolicy What a thread does between retries of a lost CAS (see wait_policy.hpp)
+ * @tparam RemapPolicy How ticket positions are spread over the ring slots (see
+ * cache_remap.hpp)
  * @note The queue uses a reserved sentinel value (@ref kEmpty) to indicate emptiness. Callers must
  * not enqueue this value. Thread-safety: @ref enqueue, @ref dequeue, and @ref is_empty are safe for
  * concurrent callers.
@@ -51,7 +58,7 @@ namespace lscq {
  * }
  * @endcode
  */
-template <class T>
+template <class T, class WaitPolicy = DefaultWaitPolicy, class RemapPolicy = DefaultRemap>
 class NCQ {
    public:
     /** @brief Slot entry type used by the queue */
@@ -65,15 +72,20 @@ class NCQ {
     /** @brief Sentinel value returned by @ref dequeue when the queue is empty */
     static constexpr T kEmpty = std::numeric_limits<T>::max();
 
+    /** @brief Number of ring slices that consecutive tickets are spread over (cache_remap.hpp). */
+    static constexpr std::size_t kRemapStride = RemapPolicy::stride(sizeof(Entry));
+    static_assert(detail::is_power_of_two(kRemapStride), "RemapPolicy::stride() must return 2^k");
+
     /**
      * @brief Construct a bounded circular queue with a given capacity
      *
      * @param capacity Number of slots in the queue
+     * @param placement NUMA node / huge-page policy for the slot array (see placement.hpp).
      * @note Implementations may clamp the capacity to a minimum and round it up to a
      * cache-line-friendly multiple.
      * @note Thread-safe: construction must complete before the queue is shared with other threads.
      */
-    explicit NCQ(std::size_t capacity = config::DEFAULT_SCQSIZE);
+    explicit NCQ(std::size_t capacity = config::DEFAULT_SCQSIZE, RingPlacement placement = {});
 
     /**
      * @brief Destroy the queue and release all internal storage
@@ -117,22 +129,50 @@ class NCQ {
      */
     bool is_empty() const noexcept;
 
-   private:
-    struct EntriesDeleter {
-        void operator()(Entry* p) const noexcept { ::operator delete[](p, std::align_val_t(64)); }
-    };
+    /** @brief Return whether the slot array lives in a huge-page mapping. */
+    bool ring_on_huge_pages() const noexcept { return entries_.on_huge_pages(); }
 
-    std::unique_ptr<Entry[], EntriesDeleter> entries_;
+   private:
+    detail::RingStorage<Entry> entries_;
     std::size_t capacity_;
-    alignas(64) std::atomic<std::uint64_t> head_;
-    alignas(64) std::atomic<std::uint64_t> tail_;
+    EntryLoadMode slot_mode_;  // Slot load/CAS2 flavour, picked once (detail::with_cas2_slots).
+    alignas(config::CACHE_LINE_SIZE) std::atomic<std::uint64_t> head_;
+    alignas(config::CACHE_LINE_SIZE) std::atomic<std::uint64_t> tail_;
 
     std::size_t cache_remap(std::size_t idx) const noexcept;
+
+    // Operation bodies, instantiated once per detail::Cas2Slots mode.
+    template <class Slots>
+    bool enqueue_with(Slots slots, T index);
+    template <class Slots>
+    T dequeue_with(Slots slots);
 };
 
-extern template class NCQ<std::uint64_t>;
-extern template class NCQ<std::uint32_t>;
+#if !LSCQ_HEADER_ONLY
+extern template class NCQ<std::uint64_t, BusySpinWait>;
+extern template class NCQ<std::uint64_t, BackoffWait>;
+extern template class NCQ<std::uint64_t, SpinThenParkWait>;
+extern template class NCQ<std::uint32_t, BusySpinWait>;
+extern template class NCQ<std::uint32_t, BackoffWait>;
+extern template class NCQ<std::uint32_t, SpinThenParkWait>;
+extern template class NCQ<std::uint64_t, BusySpinWait, IdentityRemap>;
+extern template class NCQ<std::uint64_t, BackoffWait, IdentityRemap>;
+extern template class NCQ<std::uint64_t, SpinThenParkWait, IdentityRemap>;
+extern template class NCQ<std::uint32_t, BusySpinWait, IdentityRemap>;
+extern template class NCQ<std::uint32_t, BackoffWait, IdentityRemap>;
+extern template class NCQ<std::uint32_t, SpinThenParkWait, IdentityRemap>;
+extern template class NCQ<std::uint64_t, BusySpinWait, AdjacentLineRemap>;
+extern template class NCQ<std::uint64_t, BackoffWait, AdjacentLineRemap>;
+extern template class NCQ<std::uint64_t, SpinThenParkWait, AdjacentLineRemap>;
+extern template class NCQ<std::uint32_t, BusySpinWait, AdjacentLineRemap>;
+extern template class NCQ<std::uint32_t, BackoffWait, AdjacentLineRemap>;
+extern template class NCQ<std::uint32_t, SpinThenParkWait, AdjacentLineRemap>;
+#endif
 
 }  // namespace lscq
 
+#if LSCQ_HEADER_ONLY
+#include <lscq/detail/ncq_impl.hpp>
+#endif
+
 #endif  // LSCQ_NCQ_HPP_
@@ -99,6 +99,15 @@ class ObjectPool : private detail::ObjectPoolCore<T> {
      */
     void Put(pointer obj) { this->PutShared(obj); }
 
+    /**
+     * @brief Return several objects to the pool under a single shard lock.
+     * @param objects Array of object pointers to return. Must not contain `nullptr`.
+     * @param count Number of pointers in @p objects.
+     *
+     * Equivalent to calling `Put()` for each object, but takes the shard mutex once.
+     */
+    void PutBatch(pointer* objects, std::size_t count) { this->PutSharedBatch(objects, count); }
+
     /**
      * @brief Clear the pool and delete all stored objects.
      *
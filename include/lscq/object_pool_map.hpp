@@ -17,7 +17,9 @@
 #include <atomic>
 #include <cstddef>
 #include <functional>
+#include <lscq/config.hpp>
 #include <lscq/detail/object_pool_core.hpp>
+#include <lscq/wait_policy.hpp>
 #include <mutex>
 #include <shared_mutex>
 #include <thread>
@@ -31,6 +33,8 @@ namespace lscq {
  * @brief Thread-safe object pool with per-thread single-object cache (per-pool map).
  *
  * @tparam T Object type managed by the pool.
+ * @tparam WaitPolicy How threads wait on the closing gate and for in-flight operations (see
+ * wait_policy.hpp).
  *
  * Ownership model matches ObjectPool:
  * - `Get()` returns a raw pointer owned by the caller.
@@ -43,7 +47,7 @@ namespace lscq {
  * - Clear() uses a "closing gate" (closing_ + active_ops_) to safely synchronize with concurrent
  * Get/Put.
  */
-template <class T>
+template <class T, class WaitPolicy = DefaultWaitPolicy>
 class ObjectPoolMap : private detail::ObjectPoolCore<T> {
    public:
     using value_type = T;
@@ -121,8 +125,9 @@ class ObjectPoolMap : private detail::ObjectPoolCore<T> {
     void Clear() {
         // Close the gate to prevent new operations, then wait for in-flight ops.
         closing_.store(true, std::memory_order_release);
+        WaitPolicy backoff;
         while (active_ops_.load(std::memory_order_acquire) != 0) {
-            std::this_thread::yield();
+            backoff.wait();
         }
 
         {
@@ -161,9 +166,10 @@ class ObjectPoolMap : private detail::ObjectPoolCore<T> {
     class OpGuard {
        public:
         explicit OpGuard(const ObjectPoolMap& pool) noexcept : pool_(pool) {
+            WaitPolicy backoff;
             for (;;) {
                 if (pool_.closing_.load(std::memory_order_acquire)) {
-                    std::this_thread::yield();
+                    backoff.wait();
                     continue;
                 }
 
@@ -190,12 +196,12 @@ class ObjectPoolMap : private detail::ObjectPoolCore<T> {
         const ObjectPoolMap& pool_;
     };
 
-    alignas(64) mutable std::shared_mutex cache_mutex_;
+    alignas(config::CACHE_LINE_SIZE) mutable std::shared_mutex cache_mutex_;
     mutable std::unordered_map<std::thread::id, LocalCache> caches_;
 
     // Closing gate: same pattern as LSCQ (prevent clearing while operations are active).
-    alignas(64) mutable std::atomic<int> active_ops_{0};
-    alignas(64) mutable std::atomic<bool> closing_{false};
+    alignas(config::CACHE_LINE_SIZE) mutable std::atomic<int> active_ops_{0};
+    alignas(config::CACHE_LINE_SIZE) mutable std::atomic<bool> closing_{false};
 };
 
 }  // namespace lscq
@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <functional>
 #include <lscq/detail/object_pool_core.hpp>
+#include <lscq/wait_policy.hpp>
 #include <mutex>
 #include <thread>
 #include <utility>
@@ -41,13 +42,15 @@ namespace lscq {
  * @brief Thread-safe object pool with a single thread_local fast slot.
  *
  * @tparam T Object type managed by the pool.
+ * @tparam WaitPolicy How threads wait for in-flight operations while the pool is being cleared
+ * (see wait_policy.hpp).
  *
  * Ownership model matches @ref lscq::ObjectPool:
  * - `Get()` returns a raw pointer that is owned by the caller.
  * - The caller should return it via `Put()` when done.
  * - After `Put(obj)`, `obj` must not be used again.
  */
-template <class T>
+template <class T, class WaitPolicy = DefaultWaitPolicy>
 class ObjectPoolTLS : private detail::ObjectPoolCore<T> {
    public:
     using value_type = T;
@@ -238,11 +241,12 @@ class ObjectPoolTLS : private detail::ObjectPoolCore<T> {
 
     bool WaitForActiveOpsAtMost(int threshold, std::chrono::milliseconds timeout) const noexcept {
         const auto deadline = std::chrono::steady_clock::now() + timeout;
+        WaitPolicy backoff;
         while (std::chrono::steady_clock::now() < deadline) {
             if (active_ops_.load(std::memory_order_acquire) <= threshold) {
                 return true;
             }
-            std::this_thread::yield();
+            backoff.wait();
         }
         return active_ops_.load(std::memory_order_acquire) <= threshold;
     }
@@ -27,6 +27,7 @@
 #include <functional>
 #include <lscq/detail/numa_utils.hpp>
 #include <lscq/detail/object_pool_core.hpp>
+#include <lscq/wait_policy.hpp>
 #include <mutex>
 #include <new>
 #include <thread>
@@ -52,13 +53,15 @@ namespace lscq {
  *
  * @tparam T Object type managed by the pool.
  * @tparam BatchSize Size of the per-thread batch cache (default: 8).
+ * @tparam WaitPolicy How threads wait for in-flight operations while the pool is being cleared
+ * (see wait_policy.hpp).
  *
  * Ownership model matches @ref lscq::ObjectPool:
  * - `Get()` returns a raw pointer that is owned by the caller.
  * - The caller should return it via `Put()` when done.
  * - After `Put(obj)`, `obj` must not be used again.
  */
-template <class T, std::size_t BatchSize = 8>
+template <class T, std::size_t BatchSize = 8, class WaitPolicy = DefaultWaitPolicy>
 class ObjectPoolTLSv2 : private detail::ObjectPoolCore<T> {
    public:
     using value_type = T;
@@ -438,11 +441,12 @@ class ObjectPoolTLSv2 : private detail::ObjectPoolCore<T> {
 
     bool WaitForActiveOpsAtMost(int threshold, std::chrono::milliseconds timeout) const noexcept {
         const auto deadline = std::chrono::steady_clock::now() + timeout;
+        WaitPolicy backoff;
         while (std::chrono::steady_clock::now() < deadline) {
             if (active_ops_.load(std::memory_order_acquire) <= threshold) {
                 return true;
             }
-            std::this_thread::yield();
+            backoff.wait();
         }
         return active_ops_.load(std::memory_order_acquire) <= threshold;
     }
@@ -0,0 +1,96 @@
+/**
+ * @file pool_policy.hpp
+ * @brief Node allocator policies for LSCQ: which object pool recycles its nodes.
+ * @author lscq contributors
+ * @version 0.1.0
+ *
+ * LSCQ hands drained nodes to an object pool once their grace period has ended and takes new
+ * nodes from it when the tail fills (see LSCQ::NodePool, which keeps one pool per node size). The
+ * pool implementations differ mostly in what a hit costs:
+ * - ObjectPoolPolicy: ObjectPool, a mutex per shard. Predictable, no thread-local state; the
+ *   default.
+ * - ObjectPoolTLSPolicy: ObjectPoolTLS, one thread_local fast slot in front of the shards.
+ * - ObjectPoolTLSv2Policy<B>: ObjectPoolTLSv2, fast slot plus a per-thread batch of @p B nodes.
+ * - ObjectPoolMapPolicy: ObjectPoolMap, a per-thread slot looked up under a shared_mutex.
+ *
+ * The thread-local pools keep one cache per (node type, thread), claimed by the first pool that
+ * uses it. Many queues with pools of their own therefore mostly miss it; share one
+ * LSCQ::NodePool between them so that the cache, and the nodes in it, serve all of them.
+ *
+ * A custom policy is any type with a member alias template `pool_type<Node, WaitPolicy>` naming
+ * a class constructible from `(std::function<Node*()> factory, std::size_t shard_count)` that
+ * provides `Get()`, `Put(Node*)`, `Clear()` and `Size()`, and optionally
+ * `PutBatch(Node**, std::size_t)`.
+ *
+ * The library build pre-instantiates LSCQ with each of the policies above (ObjectPoolTLSv2Policy
+ * with its default batch); any other policy needs LSCQ_HEADER_ONLY or an include of
+ * lscq/detail/lscq_impl.hpp.
+ *
+ * Example:
+ * @code
+ * using Queue = lscq::LSCQ<Job, lscq::DefaultWaitPolicy, lscq::ObjectPoolTLSv2Policy<>>;
+ * auto pool = std::make_shared<Queue::NodePool>(lscq::LSCQNodeSizing::fixed(4096));
+ * Queue a(pool), b(pool);  // b's bursts reuse the nodes a has drained, and vice versa
+ * @endcode
+ */
+
+#ifndef LSCQ_POOL_POLICY_HPP_
+#define LSCQ_POOL_POLICY_HPP_
+
+#include <cstddef>
+#include <lscq/object_pool.hpp>
+#include <lscq/object_pool_map.hpp>
+#include <lscq/object_pool_tls.hpp>
+#include <lscq/object_pool_tls_v2.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace lscq {
+
+/** @brief Recycle nodes through ObjectPool (mutex-protected shards). */
+struct ObjectPoolPolicy {
+    template <class Node, class WaitPolicy>
+    using pool_type = ObjectPool<Node>;
+};
+
+/** @brief Recycle nodes through ObjectPoolTLS (per-thread fast slot). */
+struct ObjectPoolTLSPolicy {
+    template <class Node, class WaitPolicy>
+    using pool_type = ObjectPoolTLS<Node, WaitPolicy>;
+};
+
+/**
+ * @brief Recycle nodes through ObjectPoolTLSv2 (fast slot plus per-thread batch).
+ * @tparam BatchSize Nodes kept in each thread's batch cache.
+ */
+template <std::size_t BatchSize = 8>
+struct ObjectPoolTLSv2Policy {
+    template <class Node, class WaitPolicy>
+    using pool_type = ObjectPoolTLSv2<Node, BatchSize, WaitPolicy>;
+};
+
+/** @brief Recycle nodes through ObjectPoolMap (per-thread slot in a per-pool map). */
+struct ObjectPoolMapPolicy {
+    template <class Node, class WaitPolicy>
+    using pool_type = ObjectPoolMap<Node, WaitPolicy>;
+};
+
+/** @brief Node allocator used by LSCQ unless another policy is given. */
+using DefaultPoolPolicy = ObjectPoolPolicy;
+
+namespace detail {
+
+// Whether Pool offers PutBatch(pointer*, std::size_t); pools without it get one Put per node.
+template <class Pool, class = void>
+struct has_put_batch : std::false_type {};
+
+template <class Pool>
+struct has_put_batch<Pool, std::void_t<decltype(std::declval<Pool&>().PutBatch(
+                               std::declval<typename Pool::pointer*>(), std::size_t{}))>>
+    : std::true_type {};
+
+}  // namespace detail
+
+}  // namespace lscq
+
+#endif  // LSCQ_POOL_POLICY_HPP_
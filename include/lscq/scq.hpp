@@ -15,8 +15,14 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <lscq/cache_remap.hpp>
+#include <lscq/capacity.hpp>
 #include <lscq/cas2.hpp>
 #include <lscq/config.hpp>
+#include <lscq/detail/ring_storage.hpp>
+#include <lscq/detail/scq_core.hpp>
+#include <lscq/placement.hpp>
+#include <lscq/wait_policy.hpp>
 #include <memory>
 #include <new>
 #include <type_traits>
@@ -29,9 +35,16 @@ namespace lscq {
  *
  * SCQ uses a ring of size 2n (SCQSIZE) but provides an effective usable capacity of n (QSIZE).
  * It extends the NCQ-style entry representation with a packed bitfield: cycle (63 bits) + isSafe (1
- * bit).
+ * bit). Both words are stored so that all-zero bytes mean "cycle 0, safe, empty", which lets the
+ * ring come straight from zeroed (lazily committed) memory.
  *
  * @tparam T Value type stored in the queue (must be an unsigned integral type)
+ * @tparam WaitPolicy What a thread does between retries of a lost CAS or abandoned ticket (see
+ * wait_policy.hpp)
+ * @tparam RemapPolicy How ticket positions are spread over the ring slots (see
+ * cache_remap.hpp)
+ * @tparam Capacity Ring size given at construction (DynamicCapacity) or fixed at compile time
+ * with the slots inline (FixedCapacity<N>, see capacity.hpp and FixedSCQ)
  * @note The queue uses a reserved sentinel value (@ref kEmpty) to indicate emptiness. Callers must
  * not enqueue this value.
  *
@@ -51,8 +64,9 @@ namespace lscq {
  * }
  * @endcode
  */
-template <class T>
-class SCQ {
+template <class T, class WaitPolicy = DefaultWaitPolicy, class RemapPolicy = DefaultRemap,
+          class Capacity = DynamicCapacity>
+class SCQ : private detail::ScqTickets<WaitPolicy, 3, false, Capacity> {
    public:
     /** @brief Slot entry type used by the queue (128-bit CAS2 payload) */
     using Entry = lscq::Entry;
@@ -65,14 +79,23 @@ class SCQ {
     /** @brief Sentinel value returned by @ref dequeue when the queue is empty */
     static constexpr T kEmpty = std::numeric_limits<T>::max();
 
+    /** @brief Number of ring slices that consecutive tickets are spread over (cache_remap.hpp). */
+    static constexpr std::size_t kRemapStride =
+        RemapPolicy::stride(sizeof(Entry)) < Capacity::kMaxScqSize
+            ? RemapPolicy::stride(sizeof(Entry))
+            : Capacity::kMaxScqSize;
+    static_assert(detail::is_power_of_two(kRemapStride), "RemapPolicy::stride() must return 2^k");
+
     /**
      * @brief Construct an SCQ with a given ring size
      *
      * @param scqsize Ring buffer size (2n). Implementations may clamp/round this to meet algorithm
-     * constraints.
+     * constraints. Ignored with FixedCapacity.
+     * @param placement NUMA node / huge-page policy for the slot array (see placement.hpp).
+     * Ignored with FixedCapacity, whose slots live in the queue object.
      * @note Thread-safe: construction must complete before the queue is shared with other threads.
      */
-    explicit SCQ(std::size_t scqsize = config::DEFAULT_SCQSIZE);
+    explicit SCQ(std::size_t scqsize = config::DEFAULT_SCQSIZE, RingPlacement placement = {});
 
     /**
      * @brief Destroy the queue and release all internal storage
@@ -105,6 +128,33 @@ class SCQ {
      */
     T dequeue();
 
+    /**
+     * @brief Enqueue a batch of index values with one Tail ticket claim.
+     *
+     * Tickets for the whole batch are reserved with a single fetch-add on Tail. A ticket whose slot
+     * cannot be used (stale cycle or unsafe entry) is abandoned as in @ref enqueue and the pending
+     * items move on to the following tickets, re-claiming only the shortfall.
+     *
+     * @param items Values to enqueue, in order.
+     * @param count Number of values in @p items.
+     * @return Number of values enqueued. Enqueueing stops at the first invalid value (see
+     * @ref enqueue), so the result is the length of the valid prefix of @p items.
+     */
+    std::size_t enqueue_bulk(const T* items, std::size_t count);
+
+    /**
+     * @brief Dequeue up to @p max_count values with one Head ticket claim per round.
+     *
+     * The claim is clamped to the Tail/Head distance observed just before the fetch-add, so a bulk
+     * dequeue does not invalidate more slots than a burst of single dequeues would. Tickets that
+     * come back empty are charged to the threshold in one step.
+     *
+     * @param out Output buffer with room for at least @p max_count values.
+     * @param max_count Maximum number of values to dequeue.
+     * @return Number of values written to @p out (0 if the queue is empty).
+     */
+    std::size_t dequeue_bulk(T* out, std::size_t max_count);
+
     /**
      * @brief Check whether the queue is empty.
      * @return true if empty, false otherwise.
@@ -117,41 +167,84 @@ class SCQ {
     std::size_t scqsize() const noexcept { return scqsize_; }
     /** @brief Return the usable capacity (QSIZE = n). */
     std::size_t qsize() const noexcept { return qsize_; }
+    /** @brief Return whether the slot array was placed through libnuma. */
+    bool ring_on_numa() const noexcept { return entries_.on_numa(); }
+    /** @brief Return whether the slot array lives in a huge-page mapping. */
+    bool ring_on_huge_pages() const noexcept { return entries_.on_huge_pages(); }
 
    private:
-    static constexpr std::uint64_t kIsSafeMask = 1ULL;
+    // The low bit is set when the slot is *unsafe*, so an all-zero slot reads as cycle 0, safe.
+    static constexpr std::uint64_t kIsUnsafeMask = 1ULL;
 
     static constexpr std::uint64_t pack_cycle_flags(std::uint64_t cycle, bool is_safe) noexcept {
-        return (cycle << 1) | (is_safe ? 1ULL : 0ULL);
+        return (cycle << 1) | (is_safe ? 0ULL : kIsUnsafeMask);
     }
     static constexpr std::uint64_t unpack_cycle(std::uint64_t cycle_flags) noexcept {
         return cycle_flags >> 1;
     }
     static constexpr bool unpack_is_safe(std::uint64_t cycle_flags) noexcept {
-        return (cycle_flags & kIsSafeMask) != 0;
+        return (cycle_flags & kIsUnsafeMask) == 0;
     }
 
-    struct EntriesDeleter {
-        void operator()(Entry* p) const noexcept { ::operator delete[](p, std::align_val_t(64)); }
-    };
-
-    std::unique_ptr<Entry[], EntriesDeleter> entries_;
-    std::size_t scqsize_;   // Ring size (2n).
-    std::size_t qsize_;     // Usable capacity (n).
-    std::uint64_t bottom_;  // ⊥ marker: SCQSIZE - 1 (all 1s within index mask).
-
-    alignas(64) std::atomic<std::uint64_t> head_;
-    alignas(64) std::atomic<std::uint64_t> tail_;
-    alignas(64) std::atomic<std::int64_t> threshold_;  // Dynamic threshold (init: 3 * QSIZE - 1).
+    // Slots store value ^ bottom_, so ⊥ is stored as 0 and an all-zero slot is empty. Consuming
+    // clears the index bits (the paper's "Index |= ⊥" in this encoding).
+    static constexpr std::uint64_t kEmptySlot = 0;
+    std::uint64_t encode_index(std::uint64_t value) const noexcept { return value ^ bottom_; }
+    std::uint64_t decode_index(std::uint64_t stored) const noexcept { return stored ^ bottom_; }
+
+    // Head/Tail, the threshold (3 * QSIZE - 1) and the ticket loops; a full ring makes enqueue
+    // spin.
+    using Tickets = detail::ScqTickets<WaitPolicy, 3, false, Capacity>;
+    using Tickets::bottom_;
+    using Tickets::dequeue_batch;
+    using Tickets::dequeue_one;
+    using Tickets::enqueue_batch;
+    using Tickets::enqueue_one;
+    using Tickets::head_;
+    using Tickets::qsize_;
+    using Tickets::reset_threshold_after_enqueue;
+    using Tickets::scq_shift_;
+    using Tickets::scqsize_;
+
+    static std::size_t ring_size(std::size_t requested) noexcept;
+
+    typename Capacity::template Ring<Entry> entries_;
+    EntryLoadMode slot_mode_;  // Slot load/CAS2 flavour, picked once (detail::with_cas2_slots).
 
     std::size_t cache_remap(std::size_t idx) const noexcept;
 
-    void fixState();
+    // Per-ticket steps, instantiated once per detail::Cas2Slots mode.
+    template <class Slots>
+    bool try_enqueue_at(Slots slots, std::uint64_t t, std::uint64_t value);
+    template <class Slots>
+    T try_dequeue_at(Slots slots, std::uint64_t h);  // kEmpty if the ticket is empty.
 };
 
-extern template class SCQ<std::uint64_t>;
-extern template class SCQ<std::uint32_t>;
+#if !LSCQ_HEADER_ONLY
+extern template class SCQ<std::uint64_t, BusySpinWait>;
+extern template class SCQ<std::uint64_t, BackoffWait>;
+extern template class SCQ<std::uint64_t, SpinThenParkWait>;
+extern template class SCQ<std::uint32_t, BusySpinWait>;
+extern template class SCQ<std::uint32_t, BackoffWait>;
+extern template class SCQ<std::uint32_t, SpinThenParkWait>;
+extern template class SCQ<std::uint64_t, BusySpinWait, IdentityRemap>;
+extern template class SCQ<std::uint64_t, BackoffWait, IdentityRemap>;
+extern template class SCQ<std::uint64_t, SpinThenParkWait, IdentityRemap>;
+extern template class SCQ<std::uint32_t, BusySpinWait, IdentityRemap>;
+extern template class SCQ<std::uint32_t, BackoffWait, IdentityRemap>;
+extern template class SCQ<std::uint32_t, SpinThenParkWait, IdentityRemap>;
+extern template class SCQ<std::uint64_t, BusySpinWait, AdjacentLineRemap>;
+extern template class SCQ<std::uint64_t, BackoffWait, AdjacentLineRemap>;
+extern template class SCQ<std::uint64_t, SpinThenParkWait, AdjacentLineRemap>;
+extern template class SCQ<std::uint32_t, BusySpinWait, AdjacentLineRemap>;
+extern template class SCQ<std::uint32_t, BackoffWait, AdjacentLineRemap>;
+extern template class SCQ<std::uint32_t, SpinThenParkWait, AdjacentLineRemap>;
+#endif
 
 }  // namespace lscq
 
+#if LSCQ_HEADER_ONLY
+#include <lscq/detail/scq_impl.hpp>
+#endif
+
 #endif  // LSCQ_SCQ_HPP_
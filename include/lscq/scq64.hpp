@@ -0,0 +1,252 @@
+/**
+ * @file scq64.hpp
+ * @brief SCQ64: Scalable Circular Queue with single-word (64-bit) entries.
+ * @author lscq contributors
+ * @version 0.1.0
+ *
+ * SCQ64 is the single-width layout of SCQ from the paper: cycle, IsSafe and index share one 64-bit
+ * word, so the ring only needs fetch-add, atomic OR and a 64-bit CAS. Compared to @ref SCQ it has
+ * no CAS2 dependency (no CMPXCHG16B, no mutex fallback), half the ring memory, and eight entries
+ * per cache line.
+ */
+
+#ifndef LSCQ_SCQ64_HPP_
+#define LSCQ_SCQ64_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <lscq/capacity.hpp>
+#include <lscq/config.hpp>
+#include <lscq/detail/ring_storage.hpp>
+#include <lscq/detail/scq_core.hpp>
+#include <lscq/placement.hpp>
+#include <lscq/wait_policy.hpp>
+#include <type_traits>
+
+namespace lscq {
+
+/**
+ * @class SCQ64
+ * @brief Scalable Circular Queue (SCQ) with bounded capacity and 8-byte entries.
+ *
+ * Same algorithm, capacity rules and value domain as @ref SCQ; only the slot layout differs. For a
+ * ring of SCQSIZE = 2^k entries each slot packs (high to low):
+ * - cycle: bits [k+1, 64) — the ticket's cycle, @c t >> k
+ * - IsUnsafe: bit k — the inverse of the paper's IsSafe
+ * - index: bits [0, k) — the value XOR ⊥ (⊥ = SCQSIZE - 1), so an empty slot stores 0
+ *
+ * As in @ref SCQ, an all-zero slot therefore reads as "cycle 0, safe, empty": the ring comes
+ * straight from zeroed (lazily committed) memory and construction is O(1).
+ *
+ * The cycle field is compared as (cycle << (k + 1)) with signed subtraction, so it wraps like the
+ * 64-bit Head/Tail counters it is derived from.
+ *
+ * @tparam T Value type stored in the queue (must be an unsigned integral type)
+ * @tparam WaitPolicy What a thread does between retries of a lost CAS or abandoned ticket (see
+ * wait_policy.hpp)
+ * @note The queue uses a reserved sentinel value (@ref kEmpty) to indicate emptiness. Callers must
+ * not enqueue this value.
+ *
+ * Thread-safety: @ref enqueue, @ref dequeue, and @ref is_empty are safe for concurrent callers.
+ *
+ * Complexity: O(1) expected per operation (may spin under contention).
+ *
+ * @note The usable capacity is @ref qsize (half of @ref scqsize).
+ *
+ * Example:
+ * @code
+ * lscq::SCQ64<std::uint32_t> q(1024);
+ * q.enqueue(1);
+ * const auto v = q.dequeue();
+ * if (v != lscq::SCQ64<std::uint32_t>::kEmpty) {
+ *     // got a value
+ * }
+ * @endcode
+ */
+template <class T, class WaitPolicy = DefaultWaitPolicy>
+class SCQ64 : private detail::ScqTickets<WaitPolicy, 3, false, DynamicCapacity> {
+   public:
+    static_assert(std::is_integral_v<T>, "SCQ64<T>: T must be an integral type");
+    static_assert(std::is_unsigned_v<T>, "SCQ64<T>: T must be an unsigned integral type");
+
+    /** @brief Sentinel value returned by @ref dequeue when the queue is empty */
+    static constexpr T kEmpty = std::numeric_limits<T>::max();
+
+    /**
+     * @brief Construct an SCQ64 with a given ring size
+     *
+     * @param scqsize Ring buffer size (2n). Rounded up to a power of two, at least 8 (one cache
+     * line of entries).
+     * @param placement NUMA node / huge-page policy for the slot array (see placement.hpp).
+     * @note Thread-safe: construction must complete before the queue is shared with other threads.
+     */
+    explicit SCQ64(std::size_t scqsize = config::DEFAULT_SCQSIZE, RingPlacement placement = {});
+
+    /**
+     * @brief Destroy the queue and release all internal storage
+     *
+     * @note Thread-safe: callers must ensure no other thread is accessing the queue during
+     * destruction.
+     */
+    ~SCQ64();
+
+    SCQ64(const SCQ64&) = delete;
+    SCQ64& operator=(const SCQ64&) = delete;
+    SCQ64(SCQ64&&) = delete;
+    SCQ64& operator=(SCQ64&&) = delete;
+
+    /**
+     * @brief Enqueue an index value.
+     *
+     * @param index Value to enqueue (must not equal @ref kEmpty and must be less than the internal
+     * bottom marker, SCQSIZE - 1).
+     * @return true if enqueued; false if @p index is invalid or the queue has been finalized.
+     *
+     * @note Like @ref SCQ, a full ring makes enqueue spin until space becomes available.
+     */
+    bool enqueue(T index);
+
+    /**
+     * @brief Dequeue an index value.
+     * @return Dequeued value, or @ref kEmpty if the queue is empty.
+     */
+    T dequeue();
+
+    /**
+     * @brief Enqueue a batch of index values with one Tail ticket claim.
+     *
+     * Same contract as SCQ::enqueue_bulk.
+     *
+     * @param items Values to enqueue, in order.
+     * @param count Number of values in @p items.
+     * @return Number of values enqueued: the length of the valid prefix of @p items, or less if
+     * the queue is finalized meanwhile.
+     */
+    std::size_t enqueue_bulk(const T* items, std::size_t count);
+
+    /**
+     * @brief Dequeue up to @p max_count values with one Head ticket claim per round.
+     *
+     * Same contract as SCQ::dequeue_bulk.
+     *
+     * @param out Output buffer with room for at least @p max_count values.
+     * @param max_count Maximum number of values to dequeue.
+     * @return Number of values written to @p out (0 if the queue is empty).
+     */
+    std::size_t dequeue_bulk(T* out, std::size_t max_count);
+
+    /**
+     * @brief Check whether the queue is empty.
+     * @return true if empty, false otherwise.
+     *
+     * @note This is a moment-in-time check and may become stale immediately under concurrency.
+     */
+    bool is_empty() const noexcept;
+
+    /**
+     * @brief Approximate number of stored values: the distance from Head to Tail.
+     *
+     * @note Like @ref is_empty, a moment-in-time reading. Tickets of in-flight operations are
+     * counted, so it may briefly be off by the number of concurrent callers.
+     */
+    std::size_t size_approx() const noexcept;
+
+    /**
+     * @brief Close the queue to further enqueues by setting FINALIZE on Tail.
+     *
+     * Enqueues whose ticket is taken afterwards fail; those holding an earlier ticket still
+     * complete, and dequeues keep draining. SCQP's fallback finalizes an LSCQ node through this.
+     */
+    void finalize() noexcept;
+
+    /** @brief Return whether @ref finalize was called since construction or @ref reopen. */
+    bool is_finalized() const noexcept;
+
+    /**
+     * @brief Clear FINALIZE so that a drained queue can be reused.
+     *
+     * Tail tickets taken after FINALIZE (which never write a slot) are dropped as well.
+     *
+     * @warning Not thread-safe. Must only be called with no concurrent callers.
+     */
+    void reopen() noexcept;
+
+    /**
+     * @brief Restore the dequeue threshold to 3n - 1.
+     *
+     * Only enqueues reset the threshold. Once the queue is finalized, a dequeuer that must rule
+     * out leftover elements resets it itself before its last attempt (see LSCQ::dequeue).
+     */
+    void reset_threshold() noexcept;
+
+    /** @brief Return the ring size (SCQSIZE = 2n). */
+    std::size_t scqsize() const noexcept { return scqsize_; }
+    /** @brief Return the usable capacity (QSIZE = n). */
+    std::size_t qsize() const noexcept { return qsize_; }
+    /** @brief Return whether the slot array was placed through libnuma. */
+    bool ring_on_numa() const noexcept { return entries_.on_numa(); }
+    /** @brief Return whether the slot array lives in a huge-page mapping. */
+    bool ring_on_huge_pages() const noexcept { return entries_.on_huge_pages(); }
+
+   private:
+    using Slot = std::atomic<std::uint64_t>;
+    static_assert(sizeof(Slot) == 8, "SCQ64 slots must be 8 bytes");
+
+    // Cycle bits of ticket t in slot layout: (t >> k) << (k + 1) == (t << 1) with the low k+1 bits
+    // cleared.
+    std::uint64_t ticket_cycle(std::uint64_t t) const noexcept { return (t << 1) & ~low_mask_; }
+    std::uint64_t slot_cycle(std::uint64_t e) const noexcept { return e & ~low_mask_; }
+    bool slot_is_safe(std::uint64_t e) const noexcept { return (e & unsafe_bit_) == 0; }
+
+    // The index field holds value ^ bottom_, so ⊥ is stored as 0. Consuming clears the index bits
+    // (the paper's "Index |= ⊥" in this encoding).
+    bool slot_is_empty(std::uint64_t e) const noexcept { return (e & bottom_) == 0; }
+    std::uint64_t encode_index(std::uint64_t value) const noexcept { return value ^ bottom_; }
+    std::uint64_t decode_index(std::uint64_t e) const noexcept { return (e & bottom_) ^ bottom_; }
+
+    // Head/Tail, the threshold (3 * QSIZE - 1) and the ticket loops, shared with SCQ; only the
+    // per-ticket steps below know the slot layout.
+    using Tickets = detail::ScqTickets<WaitPolicy, 3, false, DynamicCapacity>;
+    using Tickets::bottom_;
+    using Tickets::dequeue_batch;
+    using Tickets::dequeue_one;
+    using Tickets::enqueue_batch;
+    using Tickets::enqueue_one;
+    using Tickets::head_;
+    using Tickets::qsize_;
+    using Tickets::reset_threshold_after_enqueue;
+    using Tickets::scqsize_;
+    using Tickets::tail_;
+
+    static std::size_t ring_size(std::size_t requested) noexcept;
+
+    detail::RingStorage<Slot> entries_;
+    std::uint64_t unsafe_bit_;  // IsUnsafe: SCQSIZE.
+    std::uint64_t low_mask_;    // Index + IsUnsafe bits: 2 * SCQSIZE - 1.
+    unsigned line_shift_;       // log2(SCQSIZE / entries per line), for cache_remap.
+
+    std::size_t cache_remap(std::size_t idx) const noexcept;
+
+    // Per-ticket steps shared by the single-item and bulk paths.
+    bool try_enqueue_at(std::uint64_t t, T index);
+    T try_dequeue_at(std::uint64_t h);  // Returns kEmpty when the ticket is empty.
+};
+
+#if !LSCQ_HEADER_ONLY
+extern template class SCQ64<std::uint64_t, BusySpinWait>;
+extern template class SCQ64<std::uint64_t, BackoffWait>;
+extern template class SCQ64<std::uint64_t, SpinThenParkWait>;
+extern template class SCQ64<std::uint32_t, BusySpinWait>;
+extern template class SCQ64<std::uint32_t, BackoffWait>;
+extern template class SCQ64<std::uint32_t, SpinThenParkWait>;
+#endif
+
+}  // namespace lscq
+
+#if LSCQ_HEADER_ONLY
+#include <lscq/detail/scq64_impl.hpp>
+#endif
+
+#endif  // LSCQ_SCQ64_HPP_
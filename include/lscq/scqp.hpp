@@ -14,15 +14,35 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <limits>
+#include <lscq/cache_remap.hpp>
+#include <lscq/capacity.hpp>
 #include <lscq/cas2.hpp>
 #include <lscq/config.hpp>
+#include <lscq/detail/ring_storage.hpp>
+#include <lscq/detail/scq_core.hpp>
+#include <lscq/placement.hpp>
+#include <lscq/scq64.hpp>
+#include <lscq/wait_policy.hpp>
 #include <memory>
 #include <new>
 #include <type_traits>
 
 namespace lscq {
 
+namespace detail {
+
+// SCQP slot for the pointer fast path. Kept outside SCQP so that it does not depend on the wait
+// policy and the CAS2 helpers can be shared by every instantiation.
+template <class T>
+struct alignas(16) EntryP {
+    /** @brief Packed cycle counter and flags (implementation-defined bit layout). */
+    std::uint64_t cycle_flags;
+    /** @brief Pointer payload (nullptr indicates an empty slot). */
+    T* ptr;
+};
+
+}  // namespace detail
+
 /**
  * @class SCQP
  * @brief Scalable Circular Queue (SCQ) variant that stores pointers (T*).
@@ -31,11 +51,20 @@ namespace lscq {
  * returns nullptr to indicate an empty queue.
  *
  * When 128-bit CAS2 (CMPXCHG16B) is available at runtime, SCQP stores pointers directly in the slot
- * entry
- * (@ref EntryP). Otherwise it automatically falls back to an index-based entry format plus a side
- * pointer array.
+ * entry (@ref EntryP). Otherwise it falls back to the single-width layout of the paper's LSCQ: an
+ * array of SCQSIZE pointer slots plus two @ref SCQ64 index rings, aq holding the indices of
+ * occupied slots and fq the free ones. Enqueue takes an index from fq, stores the pointer and
+ * publishes the index on aq; dequeue does the reverse. Both steps only need 64-bit atomics, so the
+ * fallback stays lock-free on targets without CAS2 (no cas2_mutex on the hot path).
  *
  * @tparam T Pointee type. The queue stores pointers to T (T*).
+ * @tparam WaitPolicy What a thread does between retries of a lost CAS or abandoned ticket (see
+ * wait_policy.hpp).
+ * @tparam RemapPolicy How ticket positions are spread over the ring slots (see
+ * cache_remap.hpp). Applies to the CAS2 ring; the fallback's index rings use SCQ64's own layout.
+ * @tparam Capacity Ring size given at construction (DynamicCapacity) or fixed at compile time
+ * (FixedCapacity<N>, see capacity.hpp and FixedSCQP). A fixed CAS2 ring lives in the queue object;
+ * the fallback's pointer slots and index rings are always allocated.
  *
  * Thread-safety: @ref enqueue, @ref dequeue, and @ref is_empty are safe for concurrent callers.
  *
@@ -51,36 +80,47 @@ namespace lscq {
  * }
  * @endcode
  */
-template <class T>
-class SCQP {
+template <class T, class WaitPolicy = DefaultWaitPolicy, class RemapPolicy = DefaultRemap,
+          class Capacity = DynamicCapacity>
+class SCQP : private detail::ScqTickets<WaitPolicy, 4, true, Capacity> {
    public:
     /**
      * @brief 16-byte CAS2 payload used by the pointer fast path.
      *
      * @note When native 128-bit CAS is unavailable, SCQP falls back to an index-based entry format.
      */
-    struct alignas(16) EntryP {
-        /** @brief Packed cycle counter and flags (implementation-defined bit layout). */
-        std::uint64_t cycle_flags;
-        /** @brief Pointer payload (nullptr indicates an empty slot). */
-        T* ptr;
-    };
+    using EntryP = detail::EntryP<T>;
 
     static_assert(sizeof(EntryP) == 16, "EntryP must be 16 bytes (CAS2 payload)");
     static_assert(alignof(EntryP) == 16, "EntryP must be 16-byte aligned (CAS2 payload)");
     static_assert(sizeof(T*) == 8, "SCQP requires 64-bit pointers");
 
+    /** @brief Number of ring slices that consecutive tickets are spread over (cache_remap.hpp). */
+    static constexpr std::size_t kRemapStride =
+        RemapPolicy::stride(sizeof(EntryP)) < Capacity::kMaxScqSize
+            ? RemapPolicy::stride(sizeof(EntryP))
+            : Capacity::kMaxScqSize;
+    static_assert(detail::is_power_of_two(kRemapStride), "RemapPolicy::stride() must return 2^k");
+
     /**
      * @brief Construct an SCQP with the given ring size.
      *
      * @param scqsize Ring buffer size (2n). Implementations may clamp/round this to meet algorithm
-     * constraints.
-     * @param force_fallback If true, forces the index+side-array fallback even if CAS2 is
-     * available.
+     * constraints. Ignored with FixedCapacity.
+     * @param force_fallback If true, forces the index-ring fallback even if CAS2 is available.
+     * @param placement NUMA node / huge-page policy for the slot array(s) (see placement.hpp).
+     *
+     * @note The CAS2 ring and the fallback's pointer slots and aq start as zeroed memory, so they
+     * cost O(1) to create. Only the fallback's fq is written up front, with every slot index,
+     * which makes fallback construction O(n).
      *
      * @throws std::bad_alloc If internal storage allocation fails.
      */
-    explicit SCQP(std::size_t scqsize = config::DEFAULT_SCQSIZE, bool force_fallback = false);
+    explicit SCQP(std::size_t scqsize = config::DEFAULT_SCQSIZE, bool force_fallback = false,
+                  RingPlacement placement = {});
+
+    /** @brief Construct with an explicit ring placement and the automatic CAS2/fallback choice. */
+    SCQP(std::size_t scqsize, RingPlacement placement) : SCQP(scqsize, false, placement) {}
     ~SCQP();
 
     SCQP(const SCQP&) = delete;
@@ -91,7 +131,8 @@ class SCQP {
     /**
      * @brief Enqueue a non-null pointer.
      * @param ptr Pointer to enqueue (must not be nullptr).
-     * @return true if enqueued; false if @p ptr is null or the queue is full.
+     * @return true if enqueued; false if @p ptr is null, the queue is full, or it has been
+     * finalized.
      */
     bool enqueue(T* ptr);
 
@@ -101,6 +142,31 @@ class SCQP {
      */
     T* dequeue();
 
+    /**
+     * @brief Enqueue a batch of non-null pointers with one Tail ticket claim per round.
+     *
+     * Each round reserves min(pending, free space) tickets with a single fetch-add on Tail. Tickets
+     * whose slot cannot be used are abandoned as in @ref enqueue and the shortfall is re-claimed.
+     *
+     * @param ptrs Pointers to enqueue, in order.
+     * @param count Number of pointers in @p ptrs.
+     * @return Number of pointers enqueued. Enqueueing stops at the first nullptr or when the queue
+     * becomes full or finalized, so the result is always a prefix length of @p ptrs.
+     */
+    std::size_t enqueue_bulk(T* const* ptrs, std::size_t count);
+
+    /**
+     * @brief Dequeue up to @p max_count pointers with one Head ticket claim per round.
+     *
+     * The claim is clamped to the observed Tail/Head distance; empty tickets are charged to the
+     * threshold in one step.
+     *
+     * @param out Output buffer with room for at least @p max_count pointers.
+     * @param max_count Maximum number of pointers to dequeue.
+     * @return Number of pointers written to @p out (0 if the queue is empty).
+     */
+    std::size_t dequeue_bulk(T** out, std::size_t max_count);
+
     /**
      * @brief Check whether the queue is empty.
      * @return true if empty, false otherwise.
@@ -109,15 +175,49 @@ class SCQP {
      */
     bool is_empty() const noexcept;
 
+    /**
+     * @brief Approximate number of stored pointers: the distance from Head to Tail (of the
+     * allocated-index ring in the fallback).
+     *
+     * @note Like @ref is_empty, a moment-in-time reading. Tickets of in-flight operations are
+     * counted, so it may briefly be off by the number of concurrent callers. LSCQ reads it to
+     * decide when to stage a successor node.
+     */
+    std::size_t size_approx() const noexcept;
+
+    /**
+     * @brief Close the queue to further enqueues (FINALIZE in the paper's LSCQ).
+     *
+     * Sets a flag in Tail with one fetch_or (on the allocated-index ring's Tail in the fallback).
+     * An enqueue that finds the flag, before or in its ticket, fails without touching a slot;
+     * enqueues holding an earlier ticket still complete, and dequeues keep draining. LSCQ
+     * finalizes a full node before linking its successor, so late producers move on at once.
+     */
+    void finalize() noexcept;
+
+    /** @brief Return whether @ref finalize was called since construction or the last reset. */
+    bool is_finalized() const noexcept;
+
+    /**
+     * @brief Restore the dequeue threshold to its initial value.
+     *
+     * Only enqueues reset the threshold. Once the queue is finalized, a dequeuer that must rule
+     * out leftover elements resets it itself before its last attempt (see LSCQ::dequeue).
+     */
+    void reset_threshold() noexcept;
+
     /**
      * @brief Reset the queue to its initial state for object reuse.
      *
      * This operation is intended for scenarios where an SCQP instance is stored in an object pool
-     * and later reused. It resets internal counters (head/tail), threshold, and clears all slot
-     * entries back to the same state as a freshly constructed SCQP of the same size/mode.
+     * and later reused. It resets the threshold and the finalize flag and restarts Head/Tail on
+     * the next cycle boundary, where every existing slot reads as empty from an older cycle. The
+     * result behaves like a freshly constructed SCQP of the same size/mode, in O(1): no slot is
+     * rewritten (debug builds still scan them for leftover payloads).
      *
      * @warning Not thread-safe. Must only be called when the queue is empty and there are no
-     * concurrent calls to @ref enqueue, @ref dequeue, or @ref is_empty.
+     * concurrent calls to @ref enqueue, @ref dequeue, or @ref is_empty. A drained, finalized queue
+     * qualifies even if late enqueuers bumped Tail after FINALIZE.
      *
      * @return true if the reset was performed; false if the queue was not empty (or contained
      * residual slot payloads) and therefore could not be safely reset.
@@ -130,57 +230,101 @@ class SCQP {
     std::size_t scqsize() const noexcept { return scqsize_; }
     /** @brief Return the usable capacity (QSIZE = n). */
     std::size_t qsize() const noexcept { return qsize_; }
+    /** @brief Return whether the slot array was placed through libnuma. */
+    bool ring_on_numa() const noexcept {
+        return using_fallback_ ? ptr_array_.on_numa() : entries_p_.on_numa();
+    }
+    /** @brief Return whether the slot array lives in a huge-page mapping. */
+    bool ring_on_huge_pages() const noexcept {
+        return using_fallback_ ? ptr_array_.on_huge_pages() : entries_p_.on_huge_pages();
+    }
 
    private:
-    static constexpr std::uint64_t kIsSafeMask = 1ULL;
-    static constexpr std::uint64_t kEmptyIndex = std::numeric_limits<std::uint64_t>::max();
+    // Fallback index ring. Sized 2 * SCQSIZE so that it can hold every slot index at once and its
+    // enqueue never has to wait for space.
+    using IndexRing = SCQ64<std::uint64_t, WaitPolicy>;
+
+    // The low bit is set when the slot is *unsafe*, so an all-zero slot reads as cycle 0, safe.
+    static constexpr std::uint64_t kIsUnsafeMask = 1ULL;
+    // Indices moved between the fallback rings per bulk round (stack buffer size).
+    static constexpr std::size_t kIndexBatch = 64;
 
     static constexpr std::uint64_t pack_cycle_flags(std::uint64_t cycle, bool is_safe) noexcept {
-        return (cycle << 1) | (is_safe ? 1ULL : 0ULL);
+        return (cycle << 1) | (is_safe ? 0ULL : kIsUnsafeMask);
     }
     static constexpr std::uint64_t unpack_cycle(std::uint64_t cycle_flags) noexcept {
         return cycle_flags >> 1;
     }
     static constexpr bool unpack_is_safe(std::uint64_t cycle_flags) noexcept {
-        return (cycle_flags & kIsSafeMask) != 0;
+        return (cycle_flags & kIsUnsafeMask) == 0;
     }
 
-    struct EntriesPDeleter {
-        void operator()(EntryP* p) const noexcept { ::operator delete[](p, std::align_val_t(64)); }
-    };
-    struct EntriesDeleter {
-        void operator()(Entry* p) const noexcept { ::operator delete[](p, std::align_val_t(64)); }
-    };
-
-    std::unique_ptr<EntryP[], EntriesPDeleter> entries_p_;
-    std::unique_ptr<Entry[], EntriesDeleter> entries_i_;
-    std::unique_ptr<T*[]> ptr_array_;
-
-    std::size_t scqsize_;   // Ring size (2n).
-    std::size_t qsize_;     // QSIZE (n).
-    std::uint64_t bottom_;  // Index mask: SCQSIZE - 1.
+    typename Capacity::template Ring<EntryP> entries_p_;
+    // Fallback state: pointer slots, indices of occupied slots (aq) and of free slots (fq).
+    detail::RingStorage<T*> ptr_array_;
+    std::unique_ptr<IndexRing> alloc_ring_;
+    std::unique_ptr<IndexRing> free_ring_;
 
     bool using_fallback_;
+    EntryLoadMode slot_mode_;  // CAS2 ring load/CAS flavour, picked once (detail::with_cas2_slots).
 
-    alignas(64) std::atomic<std::uint64_t> head_;
-    alignas(64) std::atomic<std::uint64_t> tail_;
-    alignas(64) std::atomic<std::int64_t> threshold_;  // Dynamic threshold (init: 4 * QSIZE - 1).
-    alignas(64) std::atomic<std::uint64_t> deq_success_;  // Number of successful dequeues.
-    alignas(64) std::atomic<std::uint64_t> enq_success_;  // Number of successful enqueues.
+    // Head/Tail, the threshold (4 * QSIZE - 1) and the ticket loops of the CAS2 ring; enqueue
+    // fails on a full ring. The fallback uses the index rings' own.
+    using Tickets = detail::ScqTickets<WaitPolicy, 4, true, Capacity>;
+    using Tickets::bottom_;
+    using Tickets::dequeue_batch;
+    using Tickets::dequeue_one;
+    using Tickets::enqueue_batch;
+    using Tickets::enqueue_one;
+    using Tickets::head_;
+    using Tickets::qsize_;
+    using Tickets::reset_threshold_after_enqueue;
+    using Tickets::scq_shift_;
+    using Tickets::scqsize_;
+    using Tickets::tail_;
+
+    static std::size_t ring_size(std::size_t requested) noexcept;
 
     std::size_t cache_remap(std::size_t idx) const noexcept;
 
-    bool enqueue_ptr(T* ptr);
-    T* dequeue_ptr();
+    // Fallback operation bodies.
     bool enqueue_index(T* ptr);
     T* dequeue_index();
+    std::size_t enqueue_bulk_index(T* const* ptrs, std::size_t count);
+    std::size_t dequeue_bulk_index(T** out, std::size_t max_count);
 
-    void fixState();
+    // CAS2 ring per-ticket steps, instantiated once per detail::Cas2Slots mode.
+    template <class Slots>
+    bool try_enqueue_ptr_at(Slots slots, std::uint64_t t, T* ptr);
+    template <class Slots>
+    T* try_dequeue_ptr_at(Slots slots, std::uint64_t h);  // nullptr if the ticket is empty.
 };
 
-extern template class SCQP<std::uint64_t>;
-extern template class SCQP<std::uint32_t>;
+#if !LSCQ_HEADER_ONLY
+extern template class SCQP<std::uint64_t, BusySpinWait>;
+extern template class SCQP<std::uint64_t, BackoffWait>;
+extern template class SCQP<std::uint64_t, SpinThenParkWait>;
+extern template class SCQP<std::uint32_t, BusySpinWait>;
+extern template class SCQP<std::uint32_t, BackoffWait>;
+extern template class SCQP<std::uint32_t, SpinThenParkWait>;
+extern template class SCQP<std::uint64_t, BusySpinWait, IdentityRemap>;
+extern template class SCQP<std::uint64_t, BackoffWait, IdentityRemap>;
+extern template class SCQP<std::uint64_t, SpinThenParkWait, IdentityRemap>;
+extern template class SCQP<std::uint32_t, BusySpinWait, IdentityRemap>;
+extern template class SCQP<std::uint32_t, BackoffWait, IdentityRemap>;
+extern template class SCQP<std::uint32_t, SpinThenParkWait, IdentityRemap>;
+extern template class SCQP<std::uint64_t, BusySpinWait, AdjacentLineRemap>;
+extern template class SCQP<std::uint64_t, BackoffWait, AdjacentLineRemap>;
+extern template class SCQP<std::uint64_t, SpinThenParkWait, AdjacentLineRemap>;
+extern template class SCQP<std::uint32_t, BusySpinWait, AdjacentLineRemap>;
+extern template class SCQP<std::uint32_t, BackoffWait, AdjacentLineRemap>;
+extern template class SCQP<std::uint32_t, SpinThenParkWait, AdjacentLineRemap>;
+#endif
 
 }  // namespace lscq
 
+#if LSCQ_HEADER_ONLY
+#include <lscq/detail/scqp_impl.hpp>
+#endif
+
 #endif  // LSCQ_SCQP_HPP_
@@ -0,0 +1,159 @@
+/**
+ * @file sharded_queue.hpp
+ * @brief Multi-lane MPMC front end over SCQP or LSCQ lanes with per-thread lane affinity.
+ * @author lscq contributors
+ * @version 0.1.0
+ *
+ * A single SCQ/LSCQ funnels every operation through one Head/Tail counter pair. ShardedQueue
+ * spreads threads over several independent lanes instead: producers only ever enqueue to their
+ * home lane, consumers drain their home lane first and steal from the others when it runs dry.
+ * Ordering is relaxed from global FIFO to per-lane FIFO, which still preserves per-producer FIFO.
+ */
+
+#ifndef LSCQ_SHARDED_QUEUE_HPP_
+#define LSCQ_SHARDED_QUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <lscq/config.hpp>
+#include <lscq/detail/thread_id.hpp>
+#include <lscq/lscq.hpp>
+#include <lscq/scqp.hpp>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace lscq {
+
+/**
+ * @class ShardedQueue
+ * @brief Relaxed-FIFO MPMC queue made of independent SCQP or LSCQ lanes.
+ *
+ * Each thread has a home lane (its dense thread id modulo the lane count).
+ * - enqueue() only targets the home lane, so items from one producer stay in FIFO order.
+ *   With SCQP lanes a full home lane makes enqueue() fail; it never spills into another lane.
+ * - dequeue() tries the home lane, then steals from the following lanes in ring order.
+ *
+ * Every lane carries an occupancy hint on its own cache line. Producers bump it before enqueueing
+ * and consumers drop it after a successful dequeue, so the hint never under-counts a completed
+ * enqueue and a hint of zero lets consumers skip the lane without touching its Head counter.
+ *
+ * @tparam Lane SCQP<T, W> or LSCQ<T, W, P>.
+ *
+ * Thread-safety: all public methods are safe for concurrent callers.
+ *
+ * Example:
+ * @code
+ * lscq::ShardedQueue<lscq::LSCQ<Job>> q(8);  // 8 lanes
+ * q.enqueue(job);
+ * Job* j = q.dequeue();                      // nullptr if every lane is empty
+ * @endcode
+ */
+template <class Lane>
+class ShardedQueue {
+   public:
+    /** @brief Lane queue type. */
+    using lane_type = Lane;
+    /** @brief Element type accepted by enqueue and returned by dequeue (a pointer). */
+    using value_type = decltype(std::declval<Lane&>().dequeue());
+
+    /**
+     * @brief Construct @p lanes independent lanes.
+     * @param lanes Number of lanes (must be >= 1); typically the number of worker threads.
+     * @param lane_scqsize scqsize passed to each lane (SCQP ring size, or LSCQ node size).
+     * @throws std::invalid_argument if @p lanes is 0.
+     */
+    explicit ShardedQueue(std::size_t lanes, std::size_t lane_scqsize = config::DEFAULT_SCQSIZE) {
+        if (lanes == 0) {
+            throw std::invalid_argument("ShardedQueue requires at least one lane");
+        }
+        lanes_.reserve(lanes);
+        for (std::size_t i = 0; i < lanes; ++i) {
+            lanes_.push_back(std::make_unique<LaneSlot>(lane_scqsize));
+        }
+    }
+
+    ShardedQueue(const ShardedQueue&) = delete;
+    ShardedQueue& operator=(const ShardedQueue&) = delete;
+    ShardedQueue(ShardedQueue&&) = delete;
+    ShardedQueue& operator=(ShardedQueue&&) = delete;
+
+    /**
+     * @brief Enqueue into the calling thread's home lane.
+     * @return true if enqueued; false for nullptr or when a bounded (SCQP) home lane is full.
+     */
+    bool enqueue(value_type ptr) {
+        if (ptr == nullptr) {
+            return false;
+        }
+        LaneSlot& slot = *lanes_[home_lane()];
+        slot.occupancy.fetch_add(1, std::memory_order_relaxed);
+        if (!slot.queue.enqueue(ptr)) {
+            slot.occupancy.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Dequeue from the home lane, stealing from the other lanes if it is empty.
+     * @return The dequeued pointer, or nullptr if no lane yielded an element.
+     */
+    value_type dequeue() {
+        const std::size_t n = lanes_.size();
+        const std::size_t home = home_lane();
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t idx = home + i;
+            if (idx >= n) {
+                idx -= n;
+            }
+            LaneSlot& slot = *lanes_[idx];
+            if (slot.occupancy.load(std::memory_order_relaxed) <= 0) {
+                continue;
+            }
+            value_type v = slot.queue.dequeue();
+            if (v != nullptr) {
+                slot.occupancy.fetch_sub(1, std::memory_order_relaxed);
+                return v;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Check whether every lane's occupancy hint is zero.
+     * @note Approximate under concurrency; exact when the queue is quiescent.
+     */
+    bool is_empty() const noexcept {
+        for (const auto& slot : lanes_) {
+            if (slot->occupancy.load(std::memory_order_relaxed) > 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** @brief Number of lanes. */
+    std::size_t lane_count() const noexcept { return lanes_.size(); }
+
+    /** @brief Index of the calling thread's home lane. */
+    std::size_t home_lane() const noexcept { return detail::sharded_thread_id() % lanes_.size(); }
+
+   private:
+    // One lane plus its hint; heap-allocated individually so neighbouring lanes never share a
+    // cache line.
+    struct alignas(config::CACHE_LINE_SIZE) LaneSlot {
+        explicit LaneSlot(std::size_t scqsize) : queue(scqsize) {}
+
+        Lane queue;
+        alignas(config::CACHE_LINE_SIZE) std::atomic<std::int64_t> occupancy{0};
+    };
+
+    std::vector<std::unique_ptr<LaneSlot>> lanes_;
+};
+
+}  // namespace lscq
+
+#endif  // LSCQ_SHARDED_QUEUE_HPP_
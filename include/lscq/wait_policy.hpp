@@ -0,0 +1,110 @@
+/**
+ * @file wait_policy.hpp
+ * @brief Wait/backoff policies for the retry loops of the queues and object pools.
+ * @author lscq contributors
+ * @version 0.1.0
+ *
+ * Every queue and object pool takes a @c WaitPolicy template parameter that decides what a thread
+ * does between two attempts of a retry loop (a lost CAS, an abandoned ticket, a node that is not
+ * linked yet, a pool that is draining). A policy is a small value type that is constructed fresh
+ * at the start of each loop:
+ *
+ * @code
+ * WaitPolicy backoff;
+ * while (!try_once()) {
+ *     backoff.wait();
+ * }
+ * @endcode
+ *
+ * and must provide @c wait() (called after each failed attempt) and @c reset() (called when the
+ * loop made progress but has to keep going).
+ */
+
+#ifndef LSCQ_WAIT_POLICY_HPP_
+#define LSCQ_WAIT_POLICY_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <lscq/detail/platform.hpp>
+#include <thread>
+
+namespace lscq {
+
+/**
+ * @brief Retry immediately, without pausing or yielding.
+ *
+ * Lowest hand-off latency when every thread owns a core; burns the most cycles and memory
+ * bandwidth under contention, and can starve the thread it is waiting for if cores are
+ * oversubscribed.
+ */
+struct BusySpinWait {
+    void wait() noexcept {}
+    void reset() noexcept {}
+};
+
+/**
+ * @brief Exponential CPU-pause backoff that degrades to yielding the time slice.
+ *
+ * Each call doubles the number of pause instructions (1, 2, 4, ... @ref kMaxSpins); once the cap
+ * is reached every further call yields. This is the default policy.
+ */
+struct BackoffWait {
+    /** @brief Pause count at which the policy switches to yielding. */
+    static constexpr std::uint32_t kMaxSpins = 64;
+
+    void wait() noexcept {
+        if (spins_ <= kMaxSpins) {
+            for (std::uint32_t i = 0; i < spins_; ++i) {
+                detail::cpu_relax();
+            }
+            spins_ <<= 1;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    void reset() noexcept { spins_ = 1; }
+
+   private:
+    std::uint32_t spins_ = 1;
+};
+
+/**
+ * @brief Spin for a bounded number of rounds, then yield, then park with short sleeps.
+ *
+ * Suited to oversubscribed hosts and throughput-oriented deployments: a waiter stops competing for
+ * the core it is waiting on after @ref kSpinRounds + @ref kYieldRounds attempts and then sleeps
+ * for @ref kParkTime per attempt.
+ */
+struct SpinThenParkWait {
+    /** @brief Attempts that only issue a CPU pause. */
+    static constexpr std::uint32_t kSpinRounds = 128;
+    /** @brief Attempts (after spinning) that yield the time slice. */
+    static constexpr std::uint32_t kYieldRounds = 16;
+    /** @brief Sleep per attempt once spinning and yielding are exhausted. */
+    static constexpr std::chrono::microseconds kParkTime{50};
+
+    void wait() noexcept {
+        if (rounds_ < kSpinRounds) {
+            detail::cpu_relax();
+            ++rounds_;
+        } else if (rounds_ < kSpinRounds + kYieldRounds) {
+            std::this_thread::yield();
+            ++rounds_;
+        } else {
+            std::this_thread::sleep_for(kParkTime);
+        }
+    }
+
+    void reset() noexcept { rounds_ = 0; }
+
+   private:
+    std::uint32_t rounds_ = 0;
+};
+
+/** @brief Policy used when no @c WaitPolicy template argument is given. */
+using DefaultWaitPolicy = BackoffWait;
+
+}  // namespace lscq
+
+#endif  // LSCQ_WAIT_POLICY_HPP_
@@ -0,0 +1,13 @@
+#include <cstdint>
+#include <lscq/detail/scq64_impl.hpp>
+
+namespace lscq {
+
+template class SCQ64<std::uint64_t, BusySpinWait>;
+template class SCQ64<std::uint64_t, BackoffWait>;
+template class SCQ64<std::uint64_t, SpinThenParkWait>;
+template class SCQ64<std::uint32_t, BusySpinWait>;
+template class SCQ64<std::uint32_t, BackoffWait>;
+template class SCQ64<std::uint32_t, SpinThenParkWait>;
+
+}  // namespace lscq
@@ -0,0 +1,235 @@
+/**
+ * @file test_memory_order_litmus.cpp
+ * @brief Message-passing litmus tests for the audited acquire/release orders of every queue
+ *
+ * Each test passes plain (non-atomic) payloads between threads using nothing but the queue
+ * under test: producers fill a buffer and enqueue its handle, consumers dequeue the handle,
+ * validate the payload and hand the buffer back through a second queue of the same type. A
+ * queue whose publication is weaker than release/acquire shows torn payloads here (or data
+ * races under TSan). Reordering is only visible on weakly ordered hardware, so run this on
+ * AArch64 natively or through the cross build's qemu-user emulator as well as on x86.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <lscq/cas2.hpp>
+#include <lscq/fixed_scq.hpp>
+#include <lscq/fixed_scqp.hpp>
+#include <lscq/lscq.hpp>
+#include <lscq/ncq.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scqp.hpp>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kBuffers = 32;
+constexpr std::size_t kProducers = 2;
+constexpr std::size_t kConsumers = 2;
+constexpr std::uint64_t kMessagesPerProducer = 100000;
+constexpr std::uint64_t kMix = 0x9E3779B97F4A7C15ull;
+
+// Four words, so a torn payload has plenty of room to show up.
+struct alignas(64) Message {
+    std::uint64_t words[4];
+};
+
+void write_payload(Message& m, std::uint64_t v) {
+    m.words[0] = v;
+    m.words[1] = ~v;
+    m.words[2] = v * kMix;
+    m.words[3] = v ^ kMix;
+}
+
+bool payload_intact(const Message& m) {
+    const std::uint64_t v = m.words[0];
+    return m.words[1] == ~v && m.words[2] == v * kMix && m.words[3] == (v ^ kMix);
+}
+
+template <class H>
+bool is_none(H handle) {
+    if constexpr (std::is_pointer_v<H>) {
+        return handle == nullptr;
+    } else {
+        return handle == std::numeric_limits<H>::max();
+    }
+}
+
+// Handles are ring indices for index queues and pointers to the first payload word for pointer
+// queues; either way they identify one Message in `messages`.
+template <class H>
+H to_handle(std::vector<Message>& messages, std::size_t i) {
+    if constexpr (std::is_pointer_v<H>) {
+        return &messages[i].words[0];
+    } else {
+        return static_cast<H>(i);
+    }
+}
+
+template <class H>
+std::size_t from_handle(const std::vector<Message>& messages, H handle) {
+    if constexpr (std::is_pointer_v<H>) {
+        return static_cast<std::size_t>(reinterpret_cast<const Message*>(handle) - &messages[0]);
+    } else {
+        return static_cast<std::size_t>(handle);
+    }
+}
+
+template <class Queue, class H>
+H take(Queue& q) {
+    while (true) {
+        const H handle = q.dequeue();
+        if (!is_none(handle)) {
+            return handle;
+        }
+        std::this_thread::yield();
+    }
+}
+
+template <class Queue, class H>
+void put(Queue& q, H handle) {
+    while (!q.enqueue(handle)) {
+        std::this_thread::yield();
+    }
+}
+
+// Round trip: free -> producer writes -> full -> consumer reads -> free. The forward leg checks
+// enqueue-release/dequeue-acquire for the payload writes, the return leg checks that a
+// consumer's reads are ordered before the next producer's overwrite.
+template <class H, class Queue>
+void run_message_passing(Queue& free_q, Queue& full_q) {
+    std::vector<Message> messages(kBuffers);
+    for (std::size_t i = 0; i < kBuffers; ++i) {
+        write_payload(messages[i], i);
+        put(free_q, to_handle<H>(messages, i));
+    }
+
+    const std::uint64_t total = kProducers * kMessagesPerProducer;
+    std::atomic<std::uint64_t> consumed{0};
+    std::atomic<std::uint64_t> torn{0};
+
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::uint64_t k = 0; k < kMessagesPerProducer; ++k) {
+                const H handle = take<Queue, H>(free_q);
+                write_payload(messages[from_handle(messages, handle)],
+                              (static_cast<std::uint64_t>(p) << 32) | k);
+                put(full_q, handle);
+            }
+        });
+    }
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&] {
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                const H handle = full_q.dequeue();
+                if (is_none(handle)) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                if (!payload_intact(messages[from_handle(messages, handle)])) {
+                    torn.fetch_add(1, std::memory_order_relaxed);
+                }
+                put(free_q, handle);
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_EQ(consumed.load(), total);
+}
+
+}  // namespace
+
+TEST(MemoryOrderLitmus, Cas2ReleasePublishesPayload) {
+    // Ping-pong through one slot: odd cycles carry a message, even cycles acknowledge it.
+    alignas(16) lscq::Entry slot{0u, 0u};
+    Message message{};
+    constexpr std::uint64_t kRounds = 20000;
+    std::uint64_t torn = 0;
+
+    std::thread producer([&] {
+        for (std::uint64_t k = 0; k < kRounds; ++k) {
+            while (lscq::detail::entry_load(&slot).cycle_flags != 2 * k) {
+                std::this_thread::yield();
+            }
+            write_payload(message, k);
+            lscq::Entry expected{2 * k, 0u};
+            ASSERT_TRUE(lscq::cas2(&slot, expected, lscq::Entry{2 * k + 1, k},
+                                   std::memory_order_release));
+        }
+    });
+    std::thread consumer([&] {
+        for (std::uint64_t k = 0; k < kRounds; ++k) {
+            lscq::Entry seen = lscq::detail::entry_load(&slot);
+            while (seen.cycle_flags != 2 * k + 1) {
+                std::this_thread::yield();
+                seen = lscq::detail::entry_load(&slot);
+            }
+            if (!payload_intact(message) || message.words[0] != seen.index_or_ptr) {
+                ++torn;
+            }
+            lscq::Entry expected = seen;
+            ASSERT_TRUE(lscq::cas2(&slot, expected, lscq::Entry{2 * k + 2, 0u},
+                                   std::memory_order_release));
+        }
+    });
+    producer.join();
+    consumer.join();
+
+    EXPECT_EQ(torn, 0u);
+}
+
+TEST(MemoryOrderLitmus, SCQ) {
+    lscq::SCQ<std::uint64_t> free_q(128);
+    lscq::SCQ<std::uint64_t> full_q(128);
+    run_message_passing<std::uint64_t>(free_q, full_q);
+}
+
+TEST(MemoryOrderLitmus, NCQ) {
+    lscq::NCQ<std::uint64_t> free_q(128);
+    lscq::NCQ<std::uint64_t> full_q(128);
+    run_message_passing<std::uint64_t>(free_q, full_q);
+}
+
+TEST(MemoryOrderLitmus, SCQP) {
+    lscq::SCQP<std::uint64_t> free_q(128);
+    lscq::SCQP<std::uint64_t> full_q(128);
+    run_message_passing<std::uint64_t*>(free_q, full_q);
+}
+
+TEST(MemoryOrderLitmus, SCQPFallback) {
+    lscq::SCQP<std::uint64_t> free_q(128, /*force_fallback=*/true);
+    lscq::SCQP<std::uint64_t> full_q(128, /*force_fallback=*/true);
+    run_message_passing<std::uint64_t*>(free_q, full_q);
+}
+
+TEST(MemoryOrderLitmus, FixedSCQ) {
+    auto free_q = std::make_unique<lscq::FixedSCQ<std::uint64_t, 128>>();
+    auto full_q = std::make_unique<lscq::FixedSCQ<std::uint64_t, 128>>();
+    run_message_passing<std::uint64_t>(*free_q, *full_q);
+}
+
+TEST(MemoryOrderLitmus, FixedSCQP) {
+    auto free_q = std::make_unique<lscq::FixedSCQP<std::uint64_t, 128>>();
+    auto full_q = std::make_unique<lscq::FixedSCQP<std::uint64_t, 128>>();
+    run_message_passing<std::uint64_t*>(*free_q, *full_q);
+}
+
+TEST(MemoryOrderLitmus, LSCQAcrossNodes) {
+    // 32 in-flight buffers against 16-element nodes keep finalizing and linking new ones.
+    lscq::LSCQ<std::uint64_t> free_q(32);
+    lscq::LSCQ<std::uint64_t> full_q(32);
+    run_message_passing<std::uint64_t*>(free_q, full_q);
+}
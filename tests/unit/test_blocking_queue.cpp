@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <lscq/blocking_queue.hpp>
+#include <lscq/detail/event_count.hpp>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+// ============================================================================
+// EventCount Tests (3 test cases)
+// ============================================================================
+
+TEST(EventCount, NotifyWithoutWaitersDoesNotAdvanceEpoch) {
+    lscq::detail::EventCount ec;
+    const auto before = ec.prepare_wait();
+    ec.cancel_wait();
+    ec.notify_one();
+    ec.notify_all();
+    EXPECT_EQ(ec.prepare_wait(), before);
+    ec.cancel_wait();
+    EXPECT_EQ(ec.waiters(), 0u);
+}
+
+TEST(EventCount, WaitUntilTimesOut) {
+    lscq::detail::EventCount ec;
+    const auto key = ec.prepare_wait();
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(ec.wait_until(key, start + 20ms));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+    EXPECT_EQ(ec.waiters(), 0u);
+}
+
+TEST(EventCount, NotifyAllWakesParkedWaiters) {
+    lscq::detail::EventCount ec;
+    constexpr int kWaiters = 3;
+    std::atomic<int> woken{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kWaiters; ++i) {
+        threads.emplace_back([&] {
+            ec.wait(ec.prepare_wait());
+            woken.fetch_add(1, std::memory_order_relaxed);
+        });
+    }
+    while (ec.waiters() < kWaiters) {
+        std::this_thread::yield();
+    }
+    ec.notify_all();
+    for (auto& t : threads) {
+        t.join();
+    }
+    EXPECT_EQ(woken.load(), kWaiters);
+    EXPECT_EQ(ec.waiters(), 0u);
+}
+
+// ============================================================================
+// BlockingQueue Tests (6 test cases)
+// ============================================================================
+
+template <class Q>
+class BlockingQueueIntTest : public ::testing::Test {};
+
+using IntQueues = ::testing::Types<lscq::NCQ<std::uint64_t>, lscq::SCQ<std::uint64_t>>;
+TYPED_TEST_SUITE(BlockingQueueIntTest, IntQueues);
+
+TYPED_TEST(BlockingQueueIntTest, DequeueForTimesOutWhenEmpty) {
+    lscq::BlockingQueue<TypeParam> q(64);
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(q.dequeue_for(10ms), q.empty_value());
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 10ms);
+}
+
+TYPED_TEST(BlockingQueueIntTest, DequeueWaitIsWokenByProducer) {
+    lscq::BlockingQueue<TypeParam> q(64);
+    std::thread consumer([&] { EXPECT_EQ(q.dequeue_wait(), 42u); });
+    std::this_thread::sleep_for(10ms);
+    ASSERT_TRUE(q.try_enqueue(42));
+    consumer.join();
+}
+
+template <class Q>
+class BlockingQueuePtrTest : public ::testing::Test {};
+
+using PtrQueues = ::testing::Types<
+    lscq::SCQP<std::uint64_t>, lscq::LSCQ<std::uint64_t>,
+    lscq::LSCQ<std::uint64_t, lscq::DefaultWaitPolicy, lscq::ObjectPoolTLSPolicy>>;
+TYPED_TEST_SUITE(BlockingQueuePtrTest, PtrQueues);
+
+TYPED_TEST(BlockingQueuePtrTest, ProducersConsumersHandOffAllItems) {
+    lscq::BlockingQueue<TypeParam> q(64);
+    constexpr std::size_t kPerProducer = 2000;
+    constexpr std::size_t kProducers = 2;
+    constexpr std::size_t kConsumers = 2;
+    std::vector<std::uint64_t> values(kPerProducer * kProducers);
+    std::vector<std::atomic<std::uint32_t>> seen(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = i;
+    }
+
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::size_t i = 0; i < kPerProducer; ++i) {
+                auto* v = &values[p * kPerProducer + i];
+                if constexpr (lscq::BlockingQueue<TypeParam>::kBounded) {
+                    ASSERT_TRUE(q.enqueue_wait(v));
+                } else {
+                    ASSERT_TRUE(q.try_enqueue(v));
+                }
+            }
+        });
+    }
+    std::atomic<std::size_t> consumed{0};
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&] {
+            while (consumed.load(std::memory_order_relaxed) < values.size()) {
+                std::uint64_t* v = q.dequeue_for(5ms);
+                if (v != nullptr) {
+                    seen[*v].fetch_add(1, std::memory_order_relaxed);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (std::size_t i = 0; i < seen.size(); ++i) {
+        ASSERT_EQ(seen[i].load(), 1u) << "value " << i;
+    }
+}
+
+TEST(BlockingQueue, ScqEnqueueWaitBlocksUntilSpaceIsFreed) {
+    lscq::BlockingQueue<lscq::SCQ<std::uint64_t>> q(16);
+    const std::size_t cap = q.queue().qsize();
+    for (std::size_t i = 0; i < cap; ++i) {
+        ASSERT_TRUE(q.try_enqueue(i));
+    }
+    EXPECT_FALSE(q.try_enqueue(cap));
+
+    std::atomic<bool> done{false};
+    std::thread producer([&] {
+        EXPECT_TRUE(q.enqueue_wait(cap));
+        done.store(true, std::memory_order_release);
+    });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(done.load(std::memory_order_acquire));
+    EXPECT_EQ(q.try_dequeue(), 0u);
+    producer.join();
+    EXPECT_TRUE(done.load());
+
+    for (std::size_t i = 1; i <= cap; ++i) {
+        EXPECT_EQ(q.try_dequeue(), i);
+    }
+    EXPECT_EQ(q.try_dequeue(), q.empty_value());
+}
+
+TEST(BlockingQueue, ScqpEnqueueWaitBlocksUntilSpaceIsFreed) {
+    lscq::BlockingQueue<lscq::SCQP<std::uint64_t>> q(16);
+    std::vector<std::uint64_t> values(q.queue().scqsize() + 1);
+    std::size_t filled = 0;
+    while (filled < values.size() && q.try_enqueue(&values[filled])) {
+        ++filled;
+    }
+    ASSERT_LT(filled, values.size());
+
+    std::atomic<bool> done{false};
+    std::thread producer([&] {
+        EXPECT_TRUE(q.enqueue_wait(&values[filled]));
+        done.store(true, std::memory_order_release);
+    });
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(done.load(std::memory_order_acquire));
+    EXPECT_EQ(q.try_dequeue(), &values[0]);
+    producer.join();
+    EXPECT_TRUE(done.load());
+}
+
+TEST(BlockingQueue, EnqueueWaitRejectsSentinel) {
+    lscq::BlockingQueue<lscq::SCQP<std::uint64_t>> q(16);
+    EXPECT_FALSE(q.enqueue_wait(nullptr));
+    lscq::BlockingQueue<lscq::SCQ<std::uint64_t>> q2(16);
+    EXPECT_FALSE(q2.enqueue_wait(q2.empty_value()));
+}
+
+}  // namespace
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <lscq/cache_remap.hpp>
+#include <lscq/detail/ncq_impl.hpp>
+#include <lscq/detail/scq_impl.hpp>
+#include <lscq/detail/scqp_impl.hpp>
+#include <lscq/ncq.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scqp.hpp>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+// StrideRemap<16> is not pre-instantiated by the library; the *_impl.hpp includes above provide
+// its definitions, as they would for any user-defined policy.
+using Stride16 = lscq::StrideRemap<16>;
+
+template <std::size_t Stride>
+bool is_bijection(std::size_t ring_size) {
+    std::vector<int> hits(ring_size, 0);
+    for (std::size_t i = 0; i < ring_size; ++i) {
+        const std::size_t j = lscq::detail::remap_index<Stride>(i, ring_size);
+        if (j >= ring_size || hits[j]++ != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Remap Policy Tests (3 test cases)
+// ============================================================================
+
+TEST(CacheRemap_Policy, StridesFollowSlotSize) {
+    constexpr std::size_t kLine = lscq::config::CACHE_LINE_SIZE;
+    static_assert(std::is_same_v<lscq::DefaultRemap, lscq::CacheLineRemap<kLine>>);
+    static_assert(lscq::IdentityRemap::stride(16) == 1);
+    static_assert(lscq::CacheLineRemap<64>::stride(16) == 4);
+    static_assert(lscq::CacheLineRemap<64>::stride(8) == 8);
+    static_assert(lscq::CacheLineRemap<128>::stride(16) == 8);
+    static_assert(lscq::AdjacentLineRemap::stride(16) == 2 * kLine / 16);
+    static_assert(lscq::CacheLineRemap<16>::stride(32) == 1);
+    static_assert(Stride16::stride(16) == 16);
+
+    EXPECT_EQ((lscq::SCQ<std::uint64_t>::kRemapStride), kLine / 16);
+    EXPECT_EQ((lscq::SCQP<std::uint64_t, lscq::DefaultWaitPolicy,
+                          lscq::IdentityRemap>::kRemapStride),
+              1u);
+    EXPECT_EQ((lscq::NCQ<std::uint64_t, lscq::DefaultWaitPolicy,
+                         lscq::AdjacentLineRemap>::kRemapStride),
+              2 * kLine / 16);
+}
+
+TEST(CacheRemap_Policy, RemapIndexIsBijection) {
+    for (std::size_t n : {16u, 64u, 1024u}) {
+        EXPECT_TRUE(is_bijection<1>(n)) << n;
+        EXPECT_TRUE(is_bijection<4>(n)) << n;
+        EXPECT_TRUE(is_bijection<8>(n)) << n;
+        EXPECT_TRUE(is_bijection<16>(n)) << n;
+    }
+    // NCQ rings are multiples of the stride, not necessarily powers of two.
+    EXPECT_TRUE(is_bijection<4>(12));
+    EXPECT_TRUE(is_bijection<8>(24));
+}
+
+TEST(CacheRemap_Policy, LayoutSpreadsConsecutiveTicketsOverSlices) {
+    constexpr std::size_t n = 64;
+    // The original layout: four 16-byte entries per 64-byte line.
+    for (std::size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(lscq::detail::remap_index<4>(i, n), (i % 4) * (n / 4) + i / 4);
+        EXPECT_EQ(lscq::detail::remap_index<1>(i, n), i);
+    }
+    // With stride 8 the eight tickets of a 128-byte pair land 8 slots = 128 bytes apart.
+    for (std::size_t i = 0; i + 1 < 8; ++i) {
+        EXPECT_EQ(lscq::detail::remap_index<8>(i + 1, n) - lscq::detail::remap_index<8>(i, n),
+                  n / 8);
+    }
+}
+
+// ============================================================================
+// Queue Tests (4 test cases)
+// ============================================================================
+
+template <class Remap>
+void expect_scq_fifo_over_wraps() {
+    lscq::SCQ<std::uint64_t, lscq::DefaultWaitPolicy, Remap> q(64);
+    std::uint64_t next_in = 0;
+    std::uint64_t next_out = 0;
+    // Ten wraps of the ring, keeping the queue half full.
+    for (int round = 0; round < 40; ++round) {
+        for (std::size_t i = 0; i < q.qsize() / 2; ++i) {
+            ASSERT_TRUE(q.enqueue(next_in++ % 60));
+        }
+        for (std::size_t i = 0; i < q.qsize() / 2; ++i) {
+            ASSERT_EQ(q.dequeue(), next_out++ % 60);
+        }
+    }
+    EXPECT_TRUE(q.is_empty());
+}
+
+TEST(CacheRemap_Queues, ScqFifoUnderEveryPolicy) {
+    expect_scq_fifo_over_wraps<lscq::DefaultRemap>();
+    expect_scq_fifo_over_wraps<lscq::IdentityRemap>();
+    expect_scq_fifo_over_wraps<lscq::AdjacentLineRemap>();
+    expect_scq_fifo_over_wraps<Stride16>();
+}
+
+TEST(CacheRemap_Queues, RingsGrowToOneSlotPerSlice) {
+    EXPECT_EQ((lscq::SCQ<std::uint64_t, lscq::DefaultWaitPolicy, lscq::IdentityRemap>(4).scqsize()),
+              4u);
+    EXPECT_EQ((lscq::SCQ<std::uint64_t, lscq::DefaultWaitPolicy, Stride16>(4).scqsize()), 16u);
+    EXPECT_EQ((lscq::SCQP<std::uint64_t, lscq::DefaultWaitPolicy, Stride16>(4).scqsize()), 16u);
+
+    // NCQ has no capacity accessor; it must still hold one value per requested slot.
+    lscq::NCQ<std::uint64_t, lscq::DefaultWaitPolicy, Stride16> ncq(5);
+    for (std::uint64_t v = 0; v < 5; ++v) {
+        ASSERT_TRUE(ncq.enqueue(v));
+    }
+    for (std::uint64_t v = 0; v < 5; ++v) {
+        EXPECT_EQ(ncq.dequeue(), v);
+    }
+    EXPECT_EQ(ncq.dequeue(), (lscq::NCQ<std::uint64_t>::kEmpty));
+}
+
+TEST(CacheRemap_Queues, ScqpFallbackHonoursPolicy) {
+    // The policy only shapes the CAS2 ring; the index fallback must work regardless of it.
+    lscq::SCQP<std::uint64_t, lscq::DefaultWaitPolicy, lscq::AdjacentLineRemap> q(32, true);
+    ASSERT_TRUE(q.is_using_fallback());
+    std::vector<std::uint64_t> values(200);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_TRUE(q.enqueue(&values[i]));
+        ASSERT_EQ(q.dequeue(), &values[i]);
+    }
+    EXPECT_EQ(q.dequeue(), nullptr);
+}
+
+template <class Remap>
+void run_scqp_mpmc() {
+    constexpr int kProducers = 2;
+    constexpr int kConsumers = 2;
+    constexpr std::size_t kPerProducer = 20000;
+    constexpr std::size_t kTotal = kProducers * kPerProducer;
+
+    lscq::SCQP<std::uint64_t, lscq::DefaultWaitPolicy, Remap> q(256);
+    std::vector<std::uint64_t> items(kTotal);
+    std::vector<std::atomic<int>> seen(kTotal);
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::size_t i = 0; i < kPerProducer; ++i) {
+                while (!q.enqueue(&items[p * kPerProducer + i])) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&] {
+            while (consumed.load(std::memory_order_relaxed) < kTotal) {
+                std::uint64_t* it = q.dequeue();
+                if (it == nullptr) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[static_cast<std::size_t>(it - items.data())].fetch_add(1);
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (std::size_t i = 0; i < kTotal; ++i) {
+        ASSERT_EQ(seen[i].load(), 1) << "item " << i;
+    }
+    EXPECT_EQ(q.dequeue(), nullptr);
+}
+
+TEST(CacheRemap_Queues, ScqpMpmcDeliversEachItemOnceUnderEveryPolicy) {
+    run_scqp_mpmc<lscq::IdentityRemap>();
+    run_scqp_mpmc<lscq::AdjacentLineRemap>();
+    run_scqp_mpmc<Stride16>();
+}
+
+}  // namespace
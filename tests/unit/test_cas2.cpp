@@ -8,6 +8,10 @@
 #include <thread>
 #include <vector>
 
+#if LSCQ_ARCH_X86_64
+#include <emmintrin.h>
+#endif
+
 TEST(Cas2, EntryLayout) {
     EXPECT_EQ(sizeof(lscq::Entry), 16u);
     EXPECT_EQ(alignof(lscq::Entry), 16u);
@@ -41,6 +45,31 @@ TEST(Cas2_FailedOperation, FailureKeepsValueAndUpdatesExpected) {
     EXPECT_EQ(expected, (lscq::Entry{3u, 4u}));
 }
 
+TEST(Cas2_MemoryOrder, FailureOrderDropsTheReleaseHalf) {
+    using lscq::detail::cas_failure_order;
+    static_assert(cas_failure_order(std::memory_order_seq_cst) == std::memory_order_seq_cst);
+    static_assert(cas_failure_order(std::memory_order_acq_rel) == std::memory_order_acquire);
+    static_assert(cas_failure_order(std::memory_order_release) == std::memory_order_relaxed);
+    static_assert(cas_failure_order(std::memory_order_acquire) == std::memory_order_acquire);
+    static_assert(cas_failure_order(std::memory_order_relaxed) == std::memory_order_relaxed);
+}
+
+TEST(Cas2_MemoryOrder, EveryOrderKeepsCasSemantics) {
+    for (const std::memory_order order :
+         {std::memory_order_relaxed, std::memory_order_acquire, std::memory_order_release,
+          std::memory_order_acq_rel, std::memory_order_seq_cst}) {
+        lscq::Entry value{1u, 2u};
+        lscq::Entry expected = value;
+        EXPECT_TRUE(lscq::cas2(&value, expected, lscq::Entry{3u, 4u}, order));
+        EXPECT_EQ(value, (lscq::Entry{3u, 4u}));
+
+        expected = lscq::Entry{9u, 9u};
+        EXPECT_FALSE(lscq::cas2(&value, expected, lscq::Entry{5u, 6u}, order));
+        EXPECT_EQ(value, (lscq::Entry{3u, 4u}));
+        EXPECT_EQ(expected, (lscq::Entry{3u, 4u}));
+    }
+}
+
 TEST(Cas2_BasicOperation, NullPointerReturnsFalse) {
     lscq::Entry expected{1u, 2u};
     const lscq::Entry desired{3u, 4u};
@@ -251,3 +280,180 @@ TEST(Cas2_FallbackStripedLocks, ConcurrentStressSameStripeAndAllStripes) {
     }
     run(all_slots);
 }
+
+TEST(Cas2_EntryLoad, ModeMatchesWriters) {
+    const lscq::EntryLoadMode mode = lscq::entry_load_mode();
+    if (!lscq::detail::kCas2NativeCompiled || !lscq::has_cas2_support()) {
+        EXPECT_EQ(mode, lscq::EntryLoadMode::kLocked);
+        return;
+    }
+#if LSCQ_ARCH_X86_64 && !defined(__SANITIZE_THREAD__)
+    EXPECT_EQ(mode, lscq::detail::cpu_has_avx() ? lscq::EntryLoadMode::kVector
+                                                : lscq::EntryLoadMode::kTwoWord);
+#else
+    EXPECT_EQ(mode, lscq::EntryLoadMode::kTwoWord);
+#endif
+}
+
+TEST(Cas2_EntryLoad, EveryPathReturnsStoredValue) {
+    const lscq::Entry value{0x1234'5678'9abc'def0u, 0x0fed'cba9'8765'4321u};
+    EXPECT_EQ(lscq::detail::entry_load_locked(&value), value);
+    EXPECT_EQ(lscq::detail::entry_load_two_word(&value), value);
+    EXPECT_EQ(lscq::detail::entry_load_dispatch(&value), value);
+#if LSCQ_ARCH_X86_64
+    if (lscq::detail::cpu_has_avx()) {
+        EXPECT_EQ(lscq::detail::entry_load_vector(&value), value);
+    }
+#endif
+}
+
+TEST(Cas2_EntryLoad, LockFreePathsNeverObserveTornValue) {
+    // The writer must update both words atomically: native CAS2 when available, otherwise an
+    // aligned SSE store on CPUs where that is atomic.
+    const bool native = lscq::entry_load_mode() != lscq::EntryLoadMode::kLocked;
+    bool has_vector = false;
+#if LSCQ_ARCH_X86_64
+    has_vector = lscq::detail::cpu_has_avx();
+#endif
+    if (!native && !has_vector) {
+        GTEST_SKIP() << "no 16-byte atomic writer available";
+    }
+
+    constexpr std::uint64_t kWrites = 200000;
+    lscq::Entry slot{0u, 0u};
+    std::atomic<bool> done{false};
+
+    std::thread writer([&] {
+        lscq::Entry expected{0u, 0u};
+        for (std::uint64_t k = 1; k <= kWrites; ++k) {
+            const lscq::Entry desired{k, k};
+            if (native) {
+                ASSERT_TRUE(lscq::cas2(&slot, expected, desired));
+                expected = desired;
+            } else {
+#if LSCQ_ARCH_X86_64
+                const long long v = static_cast<long long>(k);
+                _mm_store_si128(reinterpret_cast<__m128i*>(&slot), _mm_set_epi64x(v, v));
+#endif
+            }
+            if ((k & 1023u) == 0) {
+                std::this_thread::yield();
+            }
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    std::uint64_t last_two_word = 0;
+#if LSCQ_ARCH_X86_64
+    std::uint64_t last_vector = 0;
+#endif
+    while (!done.load(std::memory_order_acquire)) {
+        const lscq::Entry a = lscq::detail::entry_load_two_word(&slot);
+        ASSERT_EQ(a.cycle_flags, a.index_or_ptr);
+        ASSERT_GE(a.cycle_flags, last_two_word);
+        last_two_word = a.cycle_flags;
+#if LSCQ_ARCH_X86_64
+        if (has_vector) {
+            const lscq::Entry b = lscq::detail::entry_load_vector(&slot);
+            ASSERT_EQ(b.cycle_flags, b.index_or_ptr);
+            ASSERT_GE(b.cycle_flags, last_vector);
+            last_vector = b.cycle_flags;
+        }
+#endif
+    }
+    writer.join();
+    EXPECT_EQ(lscq::detail::entry_load_dispatch(&slot), (lscq::Entry{kWrites, kWrites}));
+}
+
+namespace {
+
+// A pointer slot shaped like SCQP's EntryP, to check that the slot helpers are not tied to Entry.
+struct alignas(16) PtrSlot {
+    std::uint64_t cycle_flags;
+    const void* ptr;
+};
+
+template <class Slots>
+void expect_slots_cas_semantics() {
+    lscq::Entry value{1u, 2u};
+    lscq::Entry expected{1u, 2u};
+    EXPECT_TRUE(Slots::cas(&value, expected, lscq::Entry{3u, 4u}));
+    EXPECT_EQ(Slots::load(&value), (lscq::Entry{3u, 4u}));
+    EXPECT_EQ(expected, (lscq::Entry{1u, 2u}));
+
+    expected = lscq::Entry{1u, 2u};
+    EXPECT_FALSE(Slots::cas(&value, expected, lscq::Entry{5u, 6u}));
+    EXPECT_EQ(expected, (lscq::Entry{3u, 4u}));
+    EXPECT_EQ(Slots::load(&value), (lscq::Entry{3u, 4u}));
+
+    int a = 0;
+    int b = 0;
+    PtrSlot slot{7u, &a};
+    PtrSlot seen{7u, &b};
+    EXPECT_FALSE(Slots::cas(&slot, seen, PtrSlot{8u, nullptr}));
+    EXPECT_EQ(seen.ptr, &a);
+    EXPECT_TRUE(Slots::cas(&slot, seen, PtrSlot{8u, &b}));
+    const PtrSlot now = Slots::load(&slot);
+    EXPECT_EQ(now.cycle_flags, 8u);
+    EXPECT_EQ(now.ptr, &b);
+}
+
+}  // namespace
+
+TEST(Cas2_Dispatch, NativeCasNeedsNoCompilerFlag) {
+    // The x86-64 CMPXCHG16B path is inline asm, so it is compiled in without -mcx16.
+#if LSCQ_ARCH_X86_64 && (defined(__GNUC__) || defined(__clang__) || LSCQ_COMPILER_MSVC)
+    EXPECT_TRUE(lscq::detail::kCas2NativeCompiled);
+#endif
+    if (lscq::has_cas2_support()) {
+        EXPECT_TRUE(lscq::detail::kCas2NativeCompiled);
+        EXPECT_NE(lscq::entry_load_mode(), lscq::EntryLoadMode::kLocked);
+    }
+}
+
+TEST(Cas2_Dispatch, EveryUsableSlotModeHasCasSemantics) {
+    expect_slots_cas_semantics<lscq::detail::Cas2Slots<lscq::EntryLoadMode::kLocked>>();
+    if (!lscq::has_cas2_support()) {
+        return;
+    }
+    expect_slots_cas_semantics<lscq::detail::Cas2Slots<lscq::EntryLoadMode::kTwoWord>>();
+#if LSCQ_ARCH_X86_64
+    if (lscq::detail::cpu_has_avx()) {
+        expect_slots_cas_semantics<lscq::detail::Cas2Slots<lscq::EntryLoadMode::kVector>>();
+    }
+#endif
+}
+
+TEST(Cas2_Dispatch, WithCas2SlotsPassesTheRequestedMode) {
+    const auto mode_of = [](lscq::EntryLoadMode mode) {
+        return lscq::detail::with_cas2_slots(mode, [](auto slots) { return slots.kMode; });
+    };
+    // The process-wide mode is always instantiated; kLocked is the fallback for everything else.
+    EXPECT_EQ(mode_of(lscq::entry_load_mode()), lscq::entry_load_mode());
+    EXPECT_EQ(mode_of(lscq::EntryLoadMode::kLocked), lscq::EntryLoadMode::kLocked);
+}
+
+TEST(Cas2_Dispatch, SelectedSlotsKeepEveryConcurrentIncrement) {
+    constexpr std::size_t kThreads = 4;
+    constexpr std::uint64_t kIters = 20000;
+    lscq::Entry shared{0u, 0u};
+
+    std::vector<std::thread> ts;
+    for (std::size_t t = 0; t < kThreads; ++t) {
+        ts.emplace_back([&] {
+            lscq::detail::with_cas2_slots(lscq::entry_load_mode(), [&](auto slots) {
+                for (std::uint64_t i = 0; i < kIters; ++i) {
+                    lscq::Entry expected = slots.load(&shared);
+                    while (!slots.cas(&shared, expected,
+                                      lscq::Entry{expected.cycle_flags + 1u,
+                                                  expected.index_or_ptr + 2u})) {
+                    }
+                }
+            });
+        });
+    }
+    for (auto& t : ts) {
+        t.join();
+    }
+    EXPECT_EQ(shared, (lscq::Entry{kThreads * kIters, 2u * kThreads * kIters}));
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <lscq/fixed_scq.hpp>
+#include <lscq/fixed_scqp.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// ============================================================================
+// FixedSCQ Tests (5 test cases)
+// ============================================================================
+
+TEST(FixedSCQ_Basic, SequentialEnqueueDequeueFifo) {
+    using Queue = lscq::FixedSCQ<std::uint64_t, 256>;
+    auto q = std::make_unique<Queue>();
+    static_assert(Queue::scqsize() == 256);
+    static_assert(Queue::qsize() == 128);
+
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(q->enqueue(i));
+    }
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(q->dequeue(), i);
+    }
+
+    EXPECT_TRUE(q->is_empty());
+    EXPECT_EQ(q->dequeue(), Queue::kEmpty);
+}
+
+TEST(FixedSCQ_Basic, ManyCyclesThroughSmallRingPreserveFifo) {
+    // The smallest ring wraps every 4 tickets, so the constant shift/remap see many cycles.
+    lscq::FixedSCQ<std::uint32_t, 4> q;
+    std::uint32_t next_in = 0;
+    std::uint32_t next_out = 0;
+    for (int round = 0; round < 5000; ++round) {
+        for (int i = 0; i < 2; ++i) {
+            ASSERT_TRUE(q.enqueue(next_in++ % 3u));
+        }
+        for (int i = 0; i < 2; ++i) {
+            ASSERT_EQ(q.dequeue(), next_out++ % 3u);
+        }
+    }
+    EXPECT_EQ(q.dequeue(), (lscq::FixedSCQ<std::uint32_t, 4>::kEmpty));
+}
+
+TEST(FixedSCQ_EdgeCases, EnqueueRejectsReservedSentinelAndBottom) {
+    using Queue = lscq::FixedSCQ<std::uint64_t, 64>;
+    Queue q;
+    EXPECT_FALSE(q.enqueue(Queue::kEmpty));
+    EXPECT_FALSE(q.enqueue(63));  // ⊥
+    EXPECT_TRUE(q.enqueue(62));
+    EXPECT_EQ(q.dequeue(), 62u);
+}
+
+TEST(FixedSCQ_Bulk, SequentialBulkRoundTripPreservesFifo) {
+    auto q = std::make_unique<lscq::FixedSCQ<std::uint64_t, 256>>();
+    std::vector<std::uint64_t> in(100);
+    for (std::uint64_t i = 0; i < in.size(); ++i) {
+        in[i] = i;
+    }
+    EXPECT_EQ(q->enqueue_bulk(in.data(), in.size()), in.size());
+
+    std::vector<std::uint64_t> out(in.size() + 10);
+    EXPECT_EQ(q->dequeue_bulk(out.data(), out.size()), in.size());
+    out.resize(in.size());
+    EXPECT_EQ(out, in);
+    EXPECT_EQ(q->dequeue_bulk(out.data(), out.size()), 0u);
+}
+
+TEST(FixedSCQ_Concurrent, ProducersConsumersNoLossNoDup) {
+    constexpr std::size_t kProducers = 4;
+    constexpr std::size_t kConsumers = 4;
+    constexpr std::size_t kPerProducer = 10000;
+    constexpr std::size_t kTotal = kProducers * kPerProducer;
+
+    using Queue = lscq::FixedSCQ<std::uint64_t, (1u << 16)>;
+    auto q = std::make_unique<Queue>();
+    static_assert(kTotal < Queue::scqsize() - 1);
+
+    std::vector<std::atomic<std::uint32_t>> seen(kTotal);
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::size_t i = 0; i < kPerProducer; ++i) {
+                ASSERT_TRUE(q->enqueue(p * kPerProducer + i));
+            }
+        });
+    }
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&] {
+            while (consumed.load(std::memory_order_relaxed) < kTotal) {
+                const std::uint64_t v = q->dequeue();
+                if (v == Queue::kEmpty) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[v].fetch_add(1, std::memory_order_relaxed);
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (std::size_t i = 0; i < kTotal; ++i) {
+        ASSERT_EQ(seen[i].load(), 1u) << "value " << i;
+    }
+}
+
+// ============================================================================
+// FixedSCQP Tests (5 test cases)
+// ============================================================================
+
+TEST(FixedSCQP_Basic, SequentialEnqueueDequeueFifo) {
+    lscq::FixedSCQP<std::uint64_t, 64> q;
+    std::vector<std::uint64_t> values(50);
+    for (std::uint64_t i = 0; i < values.size(); ++i) {
+        values[i] = i;
+        ASSERT_TRUE(q.enqueue(&values[i]));
+    }
+    for (std::uint64_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(q.dequeue(), &values[i]);
+    }
+    EXPECT_TRUE(q.is_empty());
+    EXPECT_EQ(q.dequeue(), nullptr);
+    EXPECT_FALSE(q.enqueue(nullptr));
+}
+
+TEST(FixedSCQP_EdgeCases, EnqueueFailsWhenFullAndRecoversAfterDequeue) {
+    lscq::FixedSCQP<std::uint64_t, 16> q;
+    std::vector<std::uint64_t> values(q.scqsize() + 1);
+    for (std::size_t i = 0; i < q.scqsize(); ++i) {
+        ASSERT_TRUE(q.enqueue(&values[i]));
+    }
+    EXPECT_FALSE(q.enqueue(&values.back()));
+
+    EXPECT_EQ(q.dequeue(), &values[0]);
+    EXPECT_TRUE(q.enqueue(&values.back()));
+}
+
+TEST(FixedSCQP_EdgeCases, ForcedFallbackKeepsFifoAndFullBehaviour) {
+    lscq::FixedSCQP<std::uint64_t, 16> q(/*force_fallback=*/true);
+    std::vector<std::uint64_t> values(q.scqsize() + 1);
+    for (std::size_t i = 0; i < q.scqsize(); ++i) {
+        ASSERT_TRUE(q.enqueue(&values[i]));
+    }
+    EXPECT_FALSE(q.enqueue(&values.back()));
+
+    for (std::size_t i = 0; i < q.scqsize(); ++i) {
+        EXPECT_EQ(q.dequeue(), &values[i]);
+    }
+    EXPECT_EQ(q.dequeue(), nullptr);
+    EXPECT_TRUE(q.enqueue(&values.back()));
+    EXPECT_EQ(q.dequeue(), &values.back());
+}
+
+TEST(FixedSCQP_Bulk, BulkRoundTripStopsAtNullAndWhenFull) {
+    lscq::FixedSCQP<std::uint64_t, 8> q;
+    std::vector<std::uint64_t> values(12);
+    std::vector<std::uint64_t*> in;
+    for (auto& v : values) {
+        in.push_back(&v);
+    }
+
+    EXPECT_EQ(q.enqueue_bulk(in.data(), in.size()), q.scqsize());
+    std::vector<std::uint64_t*> out(in.size());
+    EXPECT_EQ(q.dequeue_bulk(out.data(), out.size()), q.scqsize());
+    for (std::size_t i = 0; i < q.scqsize(); ++i) {
+        EXPECT_EQ(out[i], in[i]);
+    }
+
+    in[2] = nullptr;
+    EXPECT_EQ(q.enqueue_bulk(in.data(), in.size()), 2u);
+}
+
+TEST(FixedSCQP_Concurrent, ProducersConsumersNoLossNoDup) {
+    constexpr std::size_t kProducers = 4;
+    constexpr std::size_t kConsumers = 4;
+    constexpr std::size_t kPerProducer = 10000;
+    constexpr std::size_t kTotal = kProducers * kPerProducer;
+
+    auto q = std::make_unique<lscq::FixedSCQP<std::uint64_t, 1024>>();
+    std::vector<std::uint64_t> values(kTotal);
+    for (std::size_t i = 0; i < kTotal; ++i) {
+        values[i] = i;
+    }
+
+    std::vector<std::atomic<std::uint32_t>> seen(kTotal);
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::size_t i = 0; i < kPerProducer; ++i) {
+                while (!q->enqueue(&values[p * kPerProducer + i])) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&] {
+            while (consumed.load(std::memory_order_relaxed) < kTotal) {
+                std::uint64_t* p = q->dequeue();
+                if (p == nullptr) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[*p].fetch_add(1, std::memory_order_relaxed);
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (std::size_t i = 0; i < kTotal; ++i) {
+        ASSERT_EQ(seen[i].load(), 1u) << "value " << i;
+    }
+}
+
+}  // namespace
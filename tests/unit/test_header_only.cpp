@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <lscq/config.hpp>
+#include <lscq/lscq.hpp>
+#include <lscq/msqueue.hpp>
+#include <lscq/ncq.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scq64.hpp>
+#include <lscq/scqp.hpp>
+#include <string>
+
+// Built against lscq::header_only without lscq_impl: each queue below is instantiated for a type
+// that the library does not pre-instantiate, so this only links if the definitions come from the
+// headers.
+static_assert(LSCQ_HEADER_ONLY, "test_header_only must be built with LSCQ_HEADER_ONLY=1");
+
+namespace {
+
+// ============================================================================
+// Header-Only Instantiation Tests (3 test cases)
+// ============================================================================
+
+TEST(HeaderOnly, IndexQueuesWorkForUint16) {
+    lscq::NCQ<std::uint16_t> ncq(64);
+    lscq::SCQ<std::uint16_t> scq(64);
+    lscq::SCQ64<std::uint16_t> scq64(64);
+    for (std::uint16_t i = 0; i < 20; ++i) {
+        ASSERT_TRUE(ncq.enqueue(i));
+        ASSERT_TRUE(scq.enqueue(i));
+        ASSERT_TRUE(scq64.enqueue(i));
+    }
+    for (std::uint16_t i = 0; i < 20; ++i) {
+        EXPECT_EQ(ncq.dequeue(), i);
+        EXPECT_EQ(scq.dequeue(), i);
+        EXPECT_EQ(scq64.dequeue(), i);
+    }
+    EXPECT_EQ(scq.dequeue(), lscq::SCQ<std::uint16_t>::kEmpty);
+}
+
+TEST(HeaderOnly, PointerQueuesWorkForStrings) {
+    std::string values[3] = {"a", "b", "c"};
+
+    lscq::SCQP<std::string> scqp(16);
+    lscq::LSCQ<std::string> lscq_q(16);
+    for (auto& v : values) {
+        ASSERT_TRUE(scqp.enqueue(&v));
+        ASSERT_TRUE(lscq_q.enqueue(&v));
+    }
+    for (auto& v : values) {
+        EXPECT_EQ(scqp.dequeue(), &v);
+        EXPECT_EQ(lscq_q.dequeue(), &v);
+    }
+    EXPECT_EQ(scqp.dequeue(), nullptr);
+    EXPECT_EQ(lscq_q.dequeue(), nullptr);
+}
+
+TEST(HeaderOnly, MsQueueWorksForStrings) {
+    lscq::MSQueue<std::string> q;
+    ASSERT_TRUE(q.enqueue("x"));
+    ASSERT_TRUE(q.enqueue("y"));
+
+    std::string out;
+    ASSERT_TRUE(q.dequeue(out));
+    EXPECT_EQ(out, "x");
+    ASSERT_TRUE(q.dequeue(out));
+    EXPECT_EQ(out, "y");
+    EXPECT_FALSE(q.dequeue(out));
+}
+
+}  // namespace
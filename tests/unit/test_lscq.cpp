@@ -140,7 +140,7 @@ TEST(LSCQ_Basic, SequentialEnqueueDequeueFifo) {
 }
 
 // ============================================================================
-// Node Expansion Tests (2 test cases)
+// Node Expansion Tests (3 test cases)
 // ============================================================================
 
 TEST(LSCQ_NodeExpansion, ExceedsInitialCapacity) {
@@ -163,6 +163,28 @@ TEST(LSCQ_NodeExpansion, ExceedsInitialCapacity) {
     EXPECT_EQ(queue.dequeue(), nullptr);
 }
 
+TEST(LSCQ_NodeExpansion, LinkedNodesAreFinalized) {
+    lscq::LSCQ<std::uint64_t> queue(16);
+    std::vector<std::uint64_t> values(40);
+    for (auto& v : values) {
+        ASSERT_TRUE(queue.enqueue(&v));
+    }
+
+    using Node = lscq::LSCQ<std::uint64_t>::Node;
+    Node* tail = queue.tail_.load();
+    for (Node* node = queue.head_.load(); node != tail; node = node->next.load()) {
+        EXPECT_TRUE(node->scqp.is_finalized());
+        EXPECT_FALSE(node->scqp.enqueue(&values[0]));
+    }
+    EXPECT_FALSE(tail->scqp.is_finalized());
+    EXPECT_GT(count_node_list(queue), 1u);
+
+    for (auto& v : values) {
+        EXPECT_EQ(queue.dequeue(), &v);
+    }
+    EXPECT_EQ(queue.dequeue(), nullptr);
+}
+
 TEST(LSCQ_NodeExpansion, FinalizeTriggersNewNode) {
     // Use tiny SCQP size to trigger finalization quickly
     lscq::LSCQ<std::uint64_t> queue(16);
@@ -200,17 +222,138 @@ TEST(LSCQ_NodeExpansion, FinalizeTriggersNewNode) {
     EXPECT_EQ(queue.dequeue(), nullptr);
 }
 
+// ============================================================================
+// Bulk Tests (3 test cases)
+// ============================================================================
+
+TEST(LSCQ_Bulk, BulkRoundTripCrossesNodeBoundaries) {
+    // Tiny nodes so that every batch spans several SCQP rings.
+    lscq::LSCQ<std::uint64_t> queue(16);
+
+    std::vector<std::uint64_t> values(300);
+    std::vector<std::uint64_t*> in(values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<std::uint64_t>(i);
+        in[i] = &values[i];
+    }
+
+    ASSERT_EQ(queue.enqueue_bulk(in.data(), 100), 100u);
+    ASSERT_EQ(queue.enqueue_bulk(in.data() + 100, 200), 200u);
+    EXPECT_GT(count_node_list(queue), 2u);
+
+    std::vector<std::uint64_t*> out(values.size() + 8, nullptr);
+    std::size_t got = queue.dequeue_bulk(out.data(), 50);
+    ASSERT_EQ(got, 50u);
+    got += queue.dequeue_bulk(out.data() + got, out.size() - got);
+    ASSERT_EQ(got, values.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(out[i], in[i]);
+    }
+
+    EXPECT_EQ(queue.dequeue_bulk(out.data(), out.size()), 0u);
+    EXPECT_EQ(queue.dequeue(), nullptr);
+    EXPECT_EQ(count_node_list(queue), 1u);
+    EXPECT_GT(queue.pool_->Size(), 0u);
+}
+
+TEST(LSCQ_Bulk, BulkStopsAtNullptrAndMixesWithSingleOps) {
+    lscq::LSCQ<std::uint64_t> queue(16);
+
+    std::uint64_t a = 1;
+    std::uint64_t b = 2;
+    std::uint64_t c = 3;
+    std::uint64_t* with_null[3] = {&a, nullptr, &b};
+    EXPECT_EQ(queue.enqueue_bulk(with_null, 3), 1u);
+    EXPECT_EQ(queue.enqueue_bulk(nullptr, 3), 0u);
+    ASSERT_TRUE(queue.enqueue(&b));
+    std::uint64_t* tail[1] = {&c};
+    ASSERT_EQ(queue.enqueue_bulk(tail, 1), 1u);
+
+    EXPECT_EQ(queue.dequeue(), &a);
+    std::uint64_t* out[4] = {};
+    ASSERT_EQ(queue.dequeue_bulk(out, 4), 2u);
+    EXPECT_EQ(out[0], &b);
+    EXPECT_EQ(out[1], &c);
+    EXPECT_EQ(queue.dequeue_bulk(out, 0), 0u);
+}
+
+// Several producers race to extend 1024-slot nodes: the FINALIZE flag in the ring's Tail must
+// keep late enqueues out of a node once its successor is linked.
+TEST(LSCQ_Bulk, ConcurrentBulkProducersConsumersNoLossNoDup) {
+    constexpr std::size_t kProducers = 4;
+    constexpr std::size_t kConsumers = 4;
+    constexpr std::size_t kPerProducer = 20000;
+    constexpr std::size_t kBatch = 32;
+    constexpr std::size_t kTotal = kProducers * kPerProducer;
+
+    lscq::LSCQ<std::uint64_t> queue(1024);
+    std::vector<std::uint64_t> values(kTotal);
+    for (std::size_t i = 0; i < kTotal; ++i) {
+        values[i] = static_cast<std::uint64_t>(i);
+    }
+    auto seen = make_atomic_bitmap(kTotal);
+    std::atomic<std::size_t> consumed{0};
+    ErrorState err;
+    SpinStart start;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p]() {
+            start.arrive_and_wait();
+            std::uint64_t* batch[kBatch];
+            for (std::size_t base = 0; base < kPerProducer; base += kBatch) {
+                for (std::size_t i = 0; i < kBatch; ++i) {
+                    batch[i] = &values[p * kPerProducer + base + i];
+                }
+                std::size_t sent = 0;
+                while (sent < kBatch) {
+                    sent += queue.enqueue_bulk(batch + sent, kBatch - sent);
+                    if (std::chrono::steady_clock::now() > deadline) {
+                        err.set(1, *batch[0]);
+                        return;
+                    }
+                }
+            }
+        });
+    }
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&]() {
+            start.arrive_and_wait();
+            std::uint64_t* batch[kBatch];
+            while (consumed.load(std::memory_order_relaxed) < kTotal) {
+                const std::size_t n = queue.dequeue_bulk(batch, kBatch);
+                for (std::size_t i = 0; i < n; ++i) {
+                    std::uint64_t idx = 0;
+                    if (!ptr_to_index(values.data(), values.size(), batch[i], idx) ||
+                        !bitmap_try_set(seen, idx)) {
+                        err.set(2, idx);
+                    }
+                }
+                consumed.fetch_add(n, std::memory_order_relaxed);
+                if (n == 0 && std::chrono::steady_clock::now() > deadline) {
+                    err.set(3, consumed.load(std::memory_order_relaxed));
+                    return;
+                }
+            }
+        });
+    }
+
+    start.release_when_all_ready(kProducers + kConsumers);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    ASSERT_TRUE(err.ok.load()) << "kind=" << err.kind.load() << " value=" << err.value.load();
+    EXPECT_EQ(consumed.load(), kTotal);
+    EXPECT_EQ(queue.dequeue(), nullptr);
+}
+
 // ============================================================================
 // Concurrent Tests (2 test cases)
 // ============================================================================
 
-// DISABLED: Continuous retry pattern in consumer threads (lines 243-248) causes intermittent
-// hangs in both local and CI environments. When producers finish early, consumers enter an
-// indefinite retry loop checking `consumed < kTotal`, which can trigger threshold exhaustion
-// in the underlying SCQP algorithm without concurrent enqueue activity to recover. This is
-// similar to previously disabled shutdown/drain tests. Successfully reproduced locally (Windows)
-// and in GitHub Actions CI (Windows x64 Debug build hangs at test 64).
-TEST(LSCQ_Concurrent, DISABLED_MPMC_CorrectnessBitmap) {
+TEST(LSCQ_Concurrent, MPMC_CorrectnessBitmap) {
 #ifdef LSCQ_CI_LIGHTWEIGHT_TESTS
     // CI environment: lightweight test parameters
     constexpr std::size_t kProducers = 2;
@@ -289,13 +432,7 @@ TEST(LSCQ_Concurrent, DISABLED_MPMC_CorrectnessBitmap) {
     ASSERT_EQ(consumed.load(), kTotal);
 }
 
-// DISABLED: This test uses a batch processing pattern (all enqueue then all dequeue)
-// which conflicts with LSCQ's design assumption of continuous producer-consumer pattern.
-// LSCQ's threshold mechanism (inherited from SCQ/SCQP) requires ongoing enqueue operations
-// to reset threshold, but in batch mode, after all enqueues complete, threshold cannot recover.
-// See paper (arXiv:1908.04511v1) Figure 8 for the underlying SCQP algorithm.
-// MPMC_CorrectnessBitmap (producer-consumer concurrent pattern) passes and validates correctness.
-TEST(LSCQ_Concurrent, DISABLED_StressTestManyThreadsLargeWorkload) {
+TEST(LSCQ_Concurrent, StressTestManyThreadsLargeWorkload) {
     constexpr std::size_t kNumThreads = 16;
     constexpr std::uint64_t kOpsPerThread = 50'000;
     constexpr std::uint64_t kTotal = kNumThreads * kOpsPerThread;
@@ -374,7 +511,7 @@ TEST(LSCQ_Concurrent, DISABLED_StressTestManyThreadsLargeWorkload) {
 }
 
 // ============================================================================
-// ObjectPool Integration Tests (3 test cases)
+// ObjectPool Integration Tests (4 test cases)
 // ============================================================================
 
 TEST(LSCQ_ObjectPoolIntegration, ObjectPoolNodeReuse) {
@@ -401,14 +538,14 @@ TEST(LSCQ_ObjectPoolIntegration, ObjectPoolNodeReuse) {
     EXPECT_EQ(queue.dequeue(), nullptr);
 
     // Drained nodes should have been returned to the internal pool.
-    const std::size_t pool_before = queue.pool_.Size();
+    const std::size_t pool_before = queue.pool_->Size();
     ASSERT_GT(pool_before, 0u);
 
     // Trigger another expansion run. If nodes are being reused, pool size should decrease.
     for (std::size_t i = 0; i < kCount; ++i) {
         ASSERT_TRUE(queue.enqueue(&values[i]));
     }
-    EXPECT_LT(queue.pool_.Size(), pool_before);
+    EXPECT_LT(queue.pool_->Size(), pool_before);
 
     // Drain again (not strictly required, but keeps the test deterministic).
     for (std::size_t i = 0; i < kCount; ++i) {
@@ -417,6 +554,40 @@ TEST(LSCQ_ObjectPoolIntegration, ObjectPoolNodeReuse) {
     EXPECT_EQ(queue.dequeue(), nullptr);
 }
 
+TEST(LSCQ_ObjectPoolIntegration, RetiredNodesWaitForInFlightOperations) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    constexpr std::size_t kCount = 64;  // Four 16-element nodes.
+    Queue queue(16);
+
+    std::vector<std::uint64_t> values(kCount);
+    const auto fill_and_drain = [&]() {
+        for (std::size_t i = 0; i < kCount; ++i) {
+            ASSERT_TRUE(queue.enqueue(&values[i]));
+        }
+        for (std::size_t i = 0; i < kCount; ++i) {
+            ASSERT_NE(queue.dequeue(), nullptr);
+        }
+        ASSERT_EQ(queue.dequeue(), nullptr);
+    };
+
+    // Stand in for an operation that another thread entered in the current epoch and has not
+    // finished: it may still hold any node unlinked from now on.
+    const std::size_t other =
+        (lscq::detail::sharded_thread_id() + 1) & (Queue::kActiveOpsShards - 1);
+    std::atomic<int>& in_flight = queue.active_ops_[other].count[queue.epoch_.load() & 1u];
+    in_flight.store(1, std::memory_order_relaxed);
+
+    const std::size_t pool_before = queue.pool_->Size();
+    fill_and_drain();
+    EXPECT_EQ(count_node_list(queue), 1u);
+    EXPECT_EQ(queue.pool_->Size(), pool_before) << "node recycled under a running operation";
+
+    // Once it has left, the next retirement recycles the nodes that were waiting in limbo.
+    in_flight.store(0, std::memory_order_release);
+    fill_and_drain();
+    EXPECT_GT(queue.pool_->Size(), pool_before);
+}
+
 TEST(LSCQ_ObjectPoolIntegration, DestructorSafety) {
 #ifdef LSCQ_CI_LIGHTWEIGHT_TESTS
     constexpr std::size_t kThreads = 4;
@@ -469,6 +640,35 @@ TEST(LSCQ_ObjectPoolIntegration, DestructorSafety) {
     SUCCEED();
 }
 
+TEST(LSCQ_ObjectPoolIntegration, DestructorWaitsForEveryActiveOpsShard) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    for (const std::size_t busy : {std::size_t{0}, Queue::kActiveOpsShards - 1}) {
+        auto queue = std::make_unique<Queue>(64);
+        Queue* const q = queue.get();  // unique_ptr::reset() nulls the owner before destroying.
+        // Stand in for an operation that a thread on shard `busy` has not finished yet; the last
+        // shard's one entered under an odd epoch.
+        const std::size_t parity = busy & 1u;
+        q->active_ops_[busy].count[parity].store(1, std::memory_order_relaxed);
+
+        std::atomic<bool> destroyed{false};
+        std::thread destroyer([&]() {
+            queue.reset();
+            destroyed.store(true, std::memory_order_release);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        EXPECT_FALSE(destroyed.load(std::memory_order_acquire)) << "shard " << busy;
+
+        // The destructor has published closing_: new operations bail out before touching a node.
+        std::uint64_t value = 1;
+        EXPECT_FALSE(q->enqueue(&value));
+        EXPECT_EQ(q->dequeue(), nullptr);
+
+        q->active_ops_[busy].count[parity].store(0, std::memory_order_release);
+        destroyer.join();
+        EXPECT_TRUE(destroyed.load());
+    }
+}
+
 TEST(LSCQ_ObjectPoolIntegration, NoMemoryLeak) {
     // This test is validated under AddressSanitizer: any leaks/UAF in node reclamation
     // will be reported by the sanitizer runtime.
@@ -507,16 +707,275 @@ TEST(LSCQ_ObjectPoolIntegration, NoMemoryLeak) {
     }
 }
 
+// ============================================================================
+// Node Sizing / Shared Pool Tests (3 test cases)
+// ============================================================================
+
+TEST(LSCQ_NodeSizing, GrowingNodesDoubleUpToTheCap) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    constexpr std::size_t kCount = 1024;
+    Queue queue(lscq::LSCQNodeSizing::growing(16, 128));
+
+    std::vector<std::uint64_t> values(kCount);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        values[i] = static_cast<std::uint64_t>(i);
+        ASSERT_TRUE(queue.enqueue(&values[i]));
+    }
+
+    // 16, 32, 64, then 128-slot nodes only.
+    std::vector<std::size_t> sizes;
+    for (Queue::Node* n = queue.head_.load(); n != nullptr; n = n->next.load()) {
+        sizes.push_back(n->scqp.scqsize());
+    }
+    ASSERT_GE(sizes.size(), 5u);
+    EXPECT_EQ(sizes[0], 16u);
+    EXPECT_EQ(sizes[1], 32u);
+    EXPECT_EQ(sizes[2], 64u);
+    for (std::size_t i = 3; i < sizes.size(); ++i) {
+        EXPECT_EQ(sizes[i], 128u) << "node " << i;
+    }
+
+    for (std::size_t i = 0; i < kCount; ++i) {
+        auto* p = queue.dequeue();
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(*p, static_cast<std::uint64_t>(i));
+    }
+    EXPECT_EQ(queue.dequeue(), nullptr);
+}
+
+TEST(LSCQ_NodeSizing, IdleQueueHoldsOneSmallNodeAndNoPoolShards) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    Queue queue(lscq::LSCQNodeSizing::growing());
+
+    Queue::Node* head = queue.head_.load();
+    EXPECT_EQ(head, queue.tail_.load());
+    EXPECT_EQ(head->scqp.scqsize(), lscq::config::LSCQ_SMALL_SCQSIZE);
+    for (std::size_t c = 0; c < queue.pool_->class_count_; ++c) {
+        EXPECT_EQ(queue.pool_->classes_[c].load(), nullptr) << "size class " << c;
+    }
+}
+
+TEST(LSCQ_NodeSizing, SharedPoolHandsNodesToOtherQueues) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    constexpr std::size_t kCount = 256;
+    auto pool = std::make_shared<Queue::NodePool>(lscq::LSCQNodeSizing::growing(16, 64));
+
+    std::vector<std::uint64_t> values(kCount);
+    {
+        Queue producer_side(pool);
+        for (std::size_t i = 0; i < kCount; ++i) {
+            ASSERT_TRUE(producer_side.enqueue(&values[i]));
+        }
+        for (std::size_t i = 0; i < kCount; ++i) {
+            ASSERT_NE(producer_side.dequeue(), nullptr);
+        }
+    }
+    // Both the retired nodes and the ones the destroyed queue still held went to the pool.
+    const std::size_t pooled = pool->Size();
+    ASSERT_GT(pooled, 0u);
+
+    Queue other(pool);
+    for (std::size_t i = 0; i < kCount; ++i) {
+        ASSERT_TRUE(other.enqueue(&values[i]));
+    }
+    EXPECT_LT(pool->Size(), pooled) << "the second queue allocated instead of reusing nodes";
+    for (std::size_t i = 0; i < kCount; ++i) {
+        auto* p = other.dequeue();
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(p, &values[i]);
+    }
+    EXPECT_EQ(other.dequeue(), nullptr);
+}
+
+// ============================================================================
+// Successor Staging Tests (3 test cases)
+// ============================================================================
+
+TEST(LSCQ_StagedSuccessor, WatermarkStagesTheNodeThatGetsLinked) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    constexpr std::size_t kNodeSize = 64;
+    constexpr std::size_t kCount = kNodeSize * 3;
+    Queue queue(lscq::LSCQNodeSizing::fixed(kNodeSize).with_staged_successor(75));
+
+    std::vector<std::uint64_t> values(kCount);
+    Queue::Node* first = queue.tail_.load();
+    for (std::size_t i = 0; i < kNodeSize * 3 / 4 - 1; ++i) {
+        ASSERT_TRUE(queue.enqueue(&values[i]));
+    }
+    EXPECT_EQ(first->staged.load(), nullptr) << "staged below the watermark";
+
+    // The enqueue that reaches 48 of 64 slots stages the successor; the one that finds the node
+    // full links exactly that node.
+    ASSERT_TRUE(queue.enqueue(&values[kNodeSize * 3 / 4 - 1]));
+    Queue::Node* staged = first->staged.load();
+    ASSERT_TRUE(Queue::is_staged_node(staged));
+    for (std::size_t i = kNodeSize * 3 / 4; i < kNodeSize; ++i) {
+        ASSERT_TRUE(queue.enqueue(&values[i]));
+    }
+    EXPECT_EQ(first->next.load(), nullptr);
+    ASSERT_TRUE(queue.enqueue(&values[kNodeSize]));
+    EXPECT_EQ(first->next.load(), staged);
+    EXPECT_EQ(queue.tail_.load(), staged);
+
+    for (std::size_t i = kNodeSize + 1; i < kCount; ++i) {
+        values[i] = static_cast<std::uint64_t>(i);
+        ASSERT_TRUE(queue.enqueue(&values[i]));
+    }
+    for (std::size_t i = 0; i < kCount; ++i) {
+        EXPECT_EQ(queue.dequeue(), &values[i]);
+    }
+    EXPECT_EQ(queue.dequeue(), nullptr);
+}
+
+TEST(LSCQ_StagedSuccessor, ManualStagingAndDestructorReturnsTheStagedNode) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    constexpr std::size_t kNodeSize = 64;
+    auto pool = std::make_shared<Queue::NodePool>(lscq::LSCQNodeSizing::fixed(kNodeSize));
+
+    std::vector<std::uint64_t> values(kNodeSize + 1);
+    {
+        Queue queue(pool);
+        Queue::Node* first = queue.tail_.load();
+        EXPECT_EQ(first->stage_at, 0u) << "no watermark was configured";
+        EXPECT_TRUE(queue.stage_successor());
+        EXPECT_FALSE(queue.stage_successor()) << "staged a second successor";
+        Queue::Node* staged = first->staged.load();
+
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            ASSERT_TRUE(queue.enqueue(&values[i]));
+        }
+        EXPECT_EQ(first->next.load(), staged);
+        EXPECT_TRUE(queue.stage_successor()) << "the new tail node takes a successor of its own";
+    }
+    // Two linked nodes plus the one staged on the tail.
+    EXPECT_EQ(pool->Size(), 3u);
+}
+
+TEST(LSCQ_StagedSuccessor, ConcurrentProducersWithStagingHelperNoLossNoDup) {
+    using Queue = lscq::LSCQ<std::uint64_t>;
+    constexpr std::size_t kProducers = 4;
+#ifdef LSCQ_CI_LIGHTWEIGHT_TESTS
+    constexpr std::size_t kPerProducer = 5000;
+#else
+    constexpr std::size_t kPerProducer = 20000;
+#endif
+    Queue queue(lscq::LSCQNodeSizing::growing(16, 256).with_staged_successor(50));
+
+    std::vector<std::uint64_t> values(kProducers * kPerProducer);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<std::uint64_t>(i);
+    }
+
+    SpinStart start;
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p]() {
+            start.arrive_and_wait();
+            for (std::size_t i = 0; i < kPerProducer; ++i) {
+                queue.enqueue(&values[p * kPerProducer + i]);
+            }
+        });
+    }
+    // Stages alongside the watermark, racing the producers' extensions.
+    std::thread helper([&]() {
+        while (!done.load(std::memory_order_acquire)) {
+            queue.stage_successor();
+            std::this_thread::yield();
+        }
+    });
+
+    start.release_when_all_ready(kProducers);
+    for (auto& t : threads) {
+        t.join();
+    }
+    done.store(true, std::memory_order_release);
+    helper.join();
+
+    std::vector<std::uint8_t> seen(values.size(), 0);
+    std::size_t got = 0;
+    while (auto* p = queue.dequeue()) {
+        ASSERT_EQ(seen[*p], 0u) << "duplicate " << *p;
+        seen[*p] = 1;
+        ++got;
+    }
+    EXPECT_EQ(got, values.size());
+}
+
+// ============================================================================
+// Pool Policy Tests (2 test cases per policy)
+// ============================================================================
+
+template <class PoolPolicy>
+class LSCQ_PoolPolicy : public ::testing::Test {};
+
+using PoolPolicies = ::testing::Types<lscq::ObjectPoolPolicy, lscq::ObjectPoolTLSPolicy,
+                                      lscq::ObjectPoolTLSv2Policy<>, lscq::ObjectPoolMapPolicy>;
+TYPED_TEST_SUITE(LSCQ_PoolPolicy, PoolPolicies);
+
+TYPED_TEST(LSCQ_PoolPolicy, NodesRecycleThroughThePolicyPool) {
+    using Queue = lscq::LSCQ<std::uint64_t, lscq::DefaultWaitPolicy, TypeParam>;
+    constexpr std::size_t kCount = 256;  // 16 nodes of 16 slots.
+    Queue queue(16);
+
+    std::vector<std::uint64_t> values(kCount);
+    for (int round = 0; round < 3; ++round) {
+        for (std::size_t i = 0; i < kCount; ++i) {
+            ASSERT_TRUE(queue.enqueue(&values[i]));
+        }
+        for (std::size_t i = 0; i < kCount; ++i) {
+            ASSERT_EQ(queue.dequeue(), &values[i]) << "round " << round;
+        }
+        ASSERT_EQ(queue.dequeue(), nullptr);
+        EXPECT_GT(queue.pool_->Size(), 0u) << "round " << round;
+    }
+}
+
+TYPED_TEST(LSCQ_PoolPolicy, ConcurrentQueuesShareOnePool) {
+    using Queue = lscq::LSCQ<std::uint64_t, lscq::DefaultWaitPolicy, TypeParam>;
+    constexpr std::size_t kQueues = 4;
+    constexpr std::size_t kBurst = 128;  // Eight 16-slot nodes per burst.
+#ifdef LSCQ_CI_LIGHTWEIGHT_TESTS
+    constexpr int kRounds = 50;
+#else
+    constexpr int kRounds = 200;
+#endif
+    auto pool = std::make_shared<typename Queue::NodePool>(lscq::LSCQNodeSizing::fixed(16));
+
+    ErrorState error;
+    std::vector<std::thread> threads;
+    for (std::size_t q = 0; q < kQueues; ++q) {
+        threads.emplace_back([&]() {
+            Queue queue(pool);
+            std::vector<std::uint64_t> values(kBurst);
+            for (int round = 0; round < kRounds; ++round) {
+                for (std::size_t i = 0; i < kBurst; ++i) {
+                    if (!queue.enqueue(&values[i])) {
+                        error.set(1, i);
+                    }
+                }
+                for (std::size_t i = 0; i < kBurst; ++i) {
+                    if (queue.dequeue() != &values[i]) {
+                        error.set(2, i);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_TRUE(error.ok.load()) << "kind " << error.kind.load() << " at " << error.value.load();
+    // Every node went back to the pool when its queue was destroyed.
+    EXPECT_GT(pool->Size(), 0u);
+}
+
 // ============================================================================
 // ASan Test (1 test case)
 // ============================================================================
 
-// DISABLED: Two-phase batch pattern (concurrent mixed workload, then single-thread drain loop)
-// conflicts with LSCQ threshold mechanism. The drain loop at line 482-493 can trigger threshold
-// false negatives with no concurrent enqueue to recover, causing 120s timeout. LSCQ's underlying
-// SCQP algorithm (see paper arXiv:1908.04511v1 Figure 8) requires continuous producer/consumer
-// concurrency for threshold recovery.
-TEST(LSCQ_ASan, DISABLED_ConcurrentEnqueueDequeueNoDataRace) {
+TEST(LSCQ_ASan, ConcurrentEnqueueDequeueNoDataRace) {
 #ifdef LSCQ_CI_LIGHTWEIGHT_TESTS
     // CI environment: lightweight test parameters (4 threads × 625 = 2500 ops)
     constexpr std::size_t kNumThreads = 4;
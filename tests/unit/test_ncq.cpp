@@ -34,8 +34,8 @@ struct SpinStart {
 };
 
 inline std::size_t cache_remap_for(std::size_t capacity, std::size_t idx) {
-    constexpr std::size_t kCacheLineSize = 64;
-    constexpr std::size_t kEntriesPerLine = kCacheLineSize / sizeof(lscq::Entry);  // 4
+    constexpr std::size_t kCacheLineSize = lscq::config::CACHE_LINE_SIZE;
+    constexpr std::size_t kEntriesPerLine = kCacheLineSize / sizeof(lscq::Entry);  // 4 at 64 B
     const std::size_t line = idx / kEntriesPerLine;
     const std::size_t offset = idx % kEntriesPerLine;
     const std::size_t num_lines = capacity / kEntriesPerLine;
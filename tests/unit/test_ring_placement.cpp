@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <lscq/detail/numa_utils.hpp>
+#include <lscq/detail/ring_storage.hpp>
+#include <lscq/lscq.hpp>
+#include <lscq/ncq.hpp>
+#include <lscq/placement.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scqp.hpp>
+#include <vector>
+
+namespace {
+
+using lscq::RingPlacement;
+namespace numa = lscq::detail::numa;
+
+const RingPlacement kAllPlacements[] = {
+    RingPlacement::default_policy(),
+    RingPlacement::local(),
+    RingPlacement::on_node(0),
+    RingPlacement::interleaved(),
+};
+
+// Large enough that kLocal goes through libnuma rather than the sub-page heap path.
+constexpr std::size_t kBigRing = 1u << 12;
+
+// ============================================================================
+// RingStorage Tests (4 test cases)
+// ============================================================================
+
+TEST(NumaPlacement_RingStorage, EveryPolicyYieldsAlignedWritableSlots) {
+    for (const RingPlacement& placement : kAllPlacements) {
+        lscq::detail::RingStorage<lscq::Entry> ring(kBigRing, placement);
+        ASSERT_TRUE(ring);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(ring.get()) % lscq::config::CACHE_LINE_SIZE, 0u);
+        for (std::size_t i = 0; i < kBigRing; ++i) {
+            ring[i] = lscq::Entry{i, i};
+        }
+        EXPECT_EQ(ring[kBigRing - 1].index_or_ptr, kBigRing - 1);
+
+        if (placement.policy == lscq::NumaPolicy::kDefault || !numa::Available()) {
+            EXPECT_FALSE(ring.on_numa());
+        } else {
+            EXPECT_TRUE(ring.on_numa());
+        }
+    }
+}
+
+TEST(NumaPlacement_RingStorage, OutOfRangeNodeFallsBackToHeap) {
+    lscq::detail::RingStorage<std::uint64_t> ring(kBigRing, RingPlacement::on_node(1 << 20));
+    ASSERT_TRUE(ring);
+    EXPECT_FALSE(ring.on_numa());
+
+    lscq::detail::RingStorage<std::uint64_t> negative(kBigRing, RingPlacement::on_node(-3));
+    ASSERT_TRUE(negative);
+    EXPECT_FALSE(negative.on_numa());
+}
+
+TEST(NumaPlacement_RingStorage, ResetReplacesStorage) {
+    lscq::detail::RingStorage<std::uint64_t> ring;
+    EXPECT_FALSE(ring);
+    ring.reset(16, RingPlacement::local());
+    ASSERT_TRUE(ring);
+    ring[15] = 7;
+    ring.reset(kBigRing, RingPlacement::interleaved());
+    ASSERT_TRUE(ring);
+    ring[kBigRing - 1] = 9;
+    EXPECT_EQ(ring[kBigRing - 1], 9u);
+}
+
+TEST(NumaPlacement_RingStorage, EveryPathHandsOutZeroedSlots) {
+    // SCQ, SCQ64, SCQP and NCQ read all-zero slots as empty and never initialize them. Cover the heap
+    // path (small rings), anonymous and NUMA mappings, and a heap block that held data before.
+    const std::size_t sizes[] = {16, kBigRing,
+                                 lscq::detail::kAnonMapThreshold / sizeof(lscq::Entry)};
+    for (const std::size_t slots : sizes) {
+        for (const RingPlacement& placement : kAllPlacements) {
+            for (int round = 0; round < 2; ++round) {
+                lscq::detail::RingStorage<lscq::Entry> ring(slots, placement);
+                ASSERT_TRUE(ring);
+                for (std::size_t i = 0; i < slots; ++i) {
+                    ASSERT_EQ(ring[i].cycle_flags, 0u) << "slots=" << slots << " i=" << i;
+                    ASSERT_EQ(ring[i].index_or_ptr, 0u) << "slots=" << slots << " i=" << i;
+                }
+                for (std::size_t i = 0; i < slots; ++i) {
+                    ring[i] = lscq::Entry{~std::uint64_t{0}, ~std::uint64_t{0}};
+                }
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Queue Placement Tests (3 test cases)
+// ============================================================================
+
+TEST(NumaPlacement_Queues, ScqRoundTripUnderEveryPlacement) {
+    for (const RingPlacement& placement : kAllPlacements) {
+        lscq::SCQ<std::uint64_t> q(kBigRing, placement);
+        EXPECT_EQ(q.ring_on_numa(),
+                  placement.policy != lscq::NumaPolicy::kDefault && numa::Available());
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            ASSERT_TRUE(q.enqueue(i));
+        }
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            EXPECT_EQ(q.dequeue(), i);
+        }
+        EXPECT_TRUE(q.is_empty());
+    }
+}
+
+TEST(NumaPlacement_Queues, ScqpRoundTripUnderEveryPlacementAndMode) {
+    std::vector<std::uint64_t> values(100);
+    for (const bool force_fallback : {false, true}) {
+        for (const RingPlacement& placement : kAllPlacements) {
+            lscq::SCQP<std::uint64_t> q(kBigRing, force_fallback, placement);
+            EXPECT_EQ(q.ring_on_numa(),
+                      placement.policy != lscq::NumaPolicy::kDefault && numa::Available());
+            for (auto& v : values) {
+                ASSERT_TRUE(q.enqueue(&v));
+            }
+            for (auto& v : values) {
+                EXPECT_EQ(q.dequeue(), &v);
+            }
+            EXPECT_EQ(q.dequeue(), nullptr);
+        }
+    }
+}
+
+TEST(NumaPlacement_Queues, LscqLinksPlacedNodesAcrossGrowth) {
+    // 64-slot nodes force many extend_tail() calls, each allocating a node with the placement.
+    std::vector<std::uint64_t> values(1000);
+    for (const RingPlacement& placement : kAllPlacements) {
+        lscq::LSCQ<std::uint64_t> q(64, placement);
+        for (auto& v : values) {
+            ASSERT_TRUE(q.enqueue(&v));
+        }
+        for (auto& v : values) {
+            EXPECT_EQ(q.dequeue(), &v);
+        }
+        EXPECT_EQ(q.dequeue(), nullptr);
+    }
+}
+
+// ============================================================================
+// Huge Page Tests (3 test cases)
+// ============================================================================
+
+TEST(HugePagePlacement_RingStorage, HugeMappingIsHugePageAlignedOrFallsBack) {
+    constexpr std::size_t kSlots = (std::size_t{3} << 20) / sizeof(lscq::Entry);  // 3 MiB
+    for (const RingPlacement& placement : kAllPlacements) {
+        lscq::detail::RingStorage<lscq::Entry> ring(kSlots, placement.with_huge_pages());
+        ASSERT_TRUE(ring);
+        const auto addr = reinterpret_cast<std::uintptr_t>(ring.get());
+        if (ring.on_huge_pages()) {
+            EXPECT_EQ(addr % lscq::detail::kHugePageSize, 0u);
+        } else {
+            EXPECT_EQ(addr % lscq::config::CACHE_LINE_SIZE, 0u);
+        }
+        for (std::size_t i = 0; i < kSlots; i += 97) {
+            ring[i] = lscq::Entry{i, i};
+        }
+        ring[kSlots - 1] = lscq::Entry{1, 2};
+        EXPECT_EQ(ring[kSlots - 1].index_or_ptr, 2u);
+    }
+}
+
+TEST(HugePagePlacement_RingStorage, DefaultPlacementNeverMapsHugePages) {
+    lscq::detail::RingStorage<lscq::Entry> ring(std::size_t{1} << 18, RingPlacement{});
+    ASSERT_TRUE(ring);
+    EXPECT_FALSE(ring.on_huge_pages());
+    EXPECT_FALSE(ring.on_numa());
+}
+
+TEST(HugePagePlacement_Queues, RoundTripOnHugePageRings) {
+    constexpr std::size_t kRing = std::size_t{1} << 17;  // 2 MiB of 16-byte entries
+
+    lscq::NCQ<std::uint64_t> ncq(kRing, RingPlacement::huge());
+    lscq::SCQ<std::uint64_t> scq(kRing, RingPlacement::huge());
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(ncq.enqueue(i));
+        ASSERT_TRUE(scq.enqueue(i));
+    }
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(ncq.dequeue(), i);
+        EXPECT_EQ(scq.dequeue(), i);
+    }
+    EXPECT_EQ(ncq.ring_on_huge_pages(), scq.ring_on_huge_pages());
+
+    std::vector<std::uint64_t> values(1000);
+    for (const bool force_fallback : {false, true}) {
+        lscq::SCQP<std::uint64_t> q(kRing, force_fallback,
+                                    RingPlacement::local().with_huge_pages());
+        for (auto& v : values) {
+            ASSERT_TRUE(q.enqueue(&v));
+        }
+        for (auto& v : values) {
+            EXPECT_EQ(q.dequeue(), &v);
+        }
+        EXPECT_EQ(q.dequeue(), nullptr);
+    }
+
+    lscq::LSCQ<std::uint64_t> lq(1u << 16, RingPlacement::huge());
+    for (auto& v : values) {
+        ASSERT_TRUE(lq.enqueue(&v));
+    }
+    for (auto& v : values) {
+        EXPECT_EQ(lq.dequeue(), &v);
+    }
+}
+
+}  // namespace
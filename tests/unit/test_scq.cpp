@@ -150,6 +150,124 @@ TEST(SCQ_EdgeCases, EnqueueSpinsWhenQueueIsFullUntilADequeueFreesSpace) {
     EXPECT_TRUE(completed.load(std::memory_order_acquire));
 }
 
+TEST(SCQ_Bulk, SequentialBulkRoundTripPreservesFifo) {
+    lscq::SCQ<std::uint64_t> q(256);
+
+    std::vector<std::uint64_t> in(100);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<std::uint64_t>(i);
+    }
+    ASSERT_EQ(q.enqueue_bulk(in.data(), 60), 60u);
+    ASSERT_EQ(q.enqueue_bulk(in.data() + 60, 40), 40u);
+
+    std::vector<std::uint64_t> out(128, lscq::SCQ<std::uint64_t>::kEmpty);
+    std::size_t got = q.dequeue_bulk(out.data(), 16);
+    ASSERT_EQ(got, 16u);
+    got += q.dequeue_bulk(out.data() + got, out.size() - got);
+    ASSERT_EQ(got, in.size());
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        EXPECT_EQ(out[i], in[i]);
+    }
+
+    EXPECT_TRUE(q.is_empty());
+    EXPECT_EQ(q.dequeue_bulk(out.data(), out.size()), 0u);
+    EXPECT_EQ(q.dequeue(), lscq::SCQ<std::uint64_t>::kEmpty);
+}
+
+TEST(SCQ_Bulk, EnqueueBulkStopsAtFirstInvalidValue) {
+    lscq::SCQ<std::uint64_t> q(16);
+
+    const std::uint64_t in[4] = {1u, 2u, lscq::SCQ<std::uint64_t>::kEmpty, 3u};
+    EXPECT_EQ(q.enqueue_bulk(in, 4), 2u);
+    EXPECT_EQ(q.enqueue_bulk(in, 0), 0u);
+    EXPECT_EQ(q.enqueue_bulk(nullptr, 4), 0u);
+
+    std::uint64_t out[4] = {};
+    ASSERT_EQ(q.dequeue_bulk(out, 4), 2u);
+    EXPECT_EQ(out[0], 1u);
+    EXPECT_EQ(out[1], 2u);
+    EXPECT_EQ(q.dequeue_bulk(out, 0), 0u);
+}
+
+TEST(SCQ_Bulk, MixesWithSingleItemOperations) {
+    lscq::SCQ<std::uint32_t> q(64);
+
+    const std::uint32_t in[3] = {10u, 11u, 12u};
+    ASSERT_TRUE(q.enqueue(9u));
+    ASSERT_EQ(q.enqueue_bulk(in, 3), 3u);
+    ASSERT_TRUE(q.enqueue(13u));
+
+    EXPECT_EQ(q.dequeue(), 9u);
+    std::uint32_t out[8] = {};
+    ASSERT_EQ(q.dequeue_bulk(out, 2), 2u);
+    EXPECT_EQ(out[0], 10u);
+    EXPECT_EQ(out[1], 11u);
+    EXPECT_EQ(q.dequeue(), 12u);
+    ASSERT_EQ(q.dequeue_bulk(out, 8), 1u);
+    EXPECT_EQ(out[0], 13u);
+}
+
+TEST(SCQ_Bulk, ConcurrentBulkProducersConsumersNoLossNoDup) {
+    constexpr std::size_t kProducers = 4;
+    constexpr std::size_t kConsumers = 4;
+    constexpr std::size_t kPerProducer = 20000;
+    constexpr std::size_t kBatch = 16;
+    constexpr std::size_t kTotal = kProducers * kPerProducer;
+
+    // Values must stay below bottom_, so the ring has to be larger than kTotal.
+    lscq::SCQ<std::uint64_t> q(1u << 17);
+    auto seen = make_atomic_bitmap(kTotal);
+    std::atomic<std::size_t> consumed{0};
+    ErrorState err;
+    SpinStart start;
+
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p]() {
+            start.arrive_and_wait();
+            std::uint64_t batch[kBatch];
+            for (std::size_t base = 0; base < kPerProducer; base += kBatch) {
+                for (std::size_t i = 0; i < kBatch; ++i) {
+                    batch[i] = static_cast<std::uint64_t>(p * kPerProducer + base + i);
+                }
+                if (q.enqueue_bulk(batch, kBatch) != kBatch) {
+                    err.set(1, batch[0]);
+                    return;
+                }
+            }
+        });
+    }
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&]() {
+            start.arrive_and_wait();
+            std::uint64_t batch[kBatch];
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+            while (consumed.load(std::memory_order_relaxed) < kTotal) {
+                const std::size_t n = q.dequeue_bulk(batch, kBatch);
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (batch[i] >= kTotal || !bitmap_try_set(seen, batch[i])) {
+                        err.set(2, batch[i]);
+                    }
+                }
+                consumed.fetch_add(n, std::memory_order_relaxed);
+                if (n == 0 && std::chrono::steady_clock::now() > deadline) {
+                    err.set(3, consumed.load(std::memory_order_relaxed));
+                    return;
+                }
+            }
+        });
+    }
+
+    start.release_when_all_ready(kProducers + kConsumers);
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    ASSERT_TRUE(err.ok.load()) << "kind=" << err.kind.load() << " value=" << err.value.load();
+    EXPECT_EQ(consumed.load(), kTotal);
+    EXPECT_EQ(q.dequeue(), lscq::SCQ<std::uint64_t>::kEmpty);
+}
+
 // DISABLED: Shutdown/drain pattern - SCQ algorithm cannot guarantee completeness
 // when all producers finish before consumers drain the queue. The threshold mechanism
 // requires concurrent enqueue activity to recover from livelock prevention state.
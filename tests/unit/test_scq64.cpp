@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <lscq/scq64.hpp>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// ============================================================================
+// Sequential Tests (7 test cases)
+// ============================================================================
+
+TEST(SCQ64_Basic, SequentialEnqueueDequeueFifo) {
+    lscq::SCQ64<std::uint64_t> q(256);
+
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(q.enqueue(i));
+    }
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(q.dequeue(), i);
+    }
+
+    EXPECT_TRUE(q.is_empty());
+    EXPECT_EQ(q.dequeue(), lscq::SCQ64<std::uint64_t>::kEmpty);
+}
+
+TEST(SCQ64_Basic, SizeIsRoundedToWholeCacheLines) {
+    // One line of 8-byte slots: 8 at the default 64-byte LSCQ_CACHE_LINE.
+    constexpr std::size_t kSlotsPerLine = lscq::config::CACHE_LINE_SIZE / sizeof(std::uint64_t);
+    lscq::SCQ64<std::uint32_t> tiny(2);
+    EXPECT_EQ(tiny.scqsize(), kSlotsPerLine);
+    EXPECT_EQ(tiny.qsize(), kSlotsPerLine / 2);
+
+    lscq::SCQ64<std::uint32_t> q(1000);
+    EXPECT_EQ(q.scqsize(), 1024u);
+    EXPECT_EQ(q.qsize(), 512u);
+}
+
+TEST(SCQ64_Basic, ManyCyclesThroughSmallRingPreserveFifo) {
+    // Every slot is reused thousands of times, exercising cycle/IsSafe packing and cache_remap.
+    lscq::SCQ64<std::uint32_t> q(16);
+    std::uint32_t next_in = 0;
+    std::uint32_t next_out = 0;
+    for (int round = 0; round < 5000; ++round) {
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_TRUE(q.enqueue(next_in++ % 15u));
+        }
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_EQ(q.dequeue(), next_out++ % 15u);
+        }
+    }
+    EXPECT_EQ(q.dequeue(), lscq::SCQ64<std::uint32_t>::kEmpty);
+}
+
+TEST(SCQ64_EdgeCases, EnqueueRejectsReservedSentinelAndBottom) {
+    lscq::SCQ64<std::uint64_t> q(64);
+    EXPECT_FALSE(q.enqueue(lscq::SCQ64<std::uint64_t>::kEmpty));
+    EXPECT_FALSE(q.enqueue(q.scqsize() - 1));  // ⊥
+    EXPECT_FALSE(q.enqueue(q.scqsize()));      // Would overflow into IsUnsafe.
+    EXPECT_TRUE(q.enqueue(q.scqsize() - 2));
+    EXPECT_EQ(q.dequeue(), q.scqsize() - 2);
+}
+
+TEST(SCQ64_EdgeCases, ValueZeroIsNotReadAsAnEmptySlot) {
+    // Slots hold value ^ ⊥, so 0 is stored with every index bit set and ⊥ with none. Cycle the
+    // ring a few times so that 0 lands in slots that were consumed before.
+    lscq::SCQ64<std::uint64_t> q(8);
+    for (int round = 0; round < 10; ++round) {
+        ASSERT_TRUE(q.enqueue(0));
+        ASSERT_TRUE(q.enqueue(q.scqsize() - 2));
+        EXPECT_FALSE(q.is_empty());
+        EXPECT_EQ(q.dequeue(), 0u);
+        EXPECT_EQ(q.dequeue(), q.scqsize() - 2);
+    }
+    EXPECT_EQ(q.dequeue(), lscq::SCQ64<std::uint64_t>::kEmpty);
+}
+
+TEST(SCQ64_Bulk, SequentialBulkRoundTripPreservesFifo) {
+    lscq::SCQ64<std::uint64_t> q(256);
+    std::vector<std::uint64_t> in(100);
+    for (std::uint64_t i = 0; i < in.size(); ++i) {
+        in[i] = i;
+    }
+    EXPECT_EQ(q.enqueue_bulk(in.data(), in.size()), in.size());
+
+    std::vector<std::uint64_t> out(in.size() + 10);
+    EXPECT_EQ(q.dequeue_bulk(out.data(), out.size()), in.size());
+    out.resize(in.size());
+    EXPECT_EQ(out, in);
+    EXPECT_EQ(q.dequeue_bulk(out.data(), out.size()), 0u);
+}
+
+TEST(SCQ64_EdgeCases, FinalizedQueueRejectsEnqueuesButStillDrains) {
+    lscq::SCQ64<std::uint64_t> q(64);
+    const std::uint64_t items[4] = {1, 2, 3, 4};
+    ASSERT_TRUE(q.enqueue(0));
+    EXPECT_FALSE(q.is_finalized());
+
+    q.finalize();
+    EXPECT_TRUE(q.is_finalized());
+    EXPECT_FALSE(q.enqueue(5));
+    EXPECT_EQ(q.enqueue_bulk(items, 4), 0u);
+
+    q.reset_threshold();
+    EXPECT_EQ(q.dequeue(), 0u);
+    EXPECT_EQ(q.dequeue(), lscq::SCQ64<std::uint64_t>::kEmpty);
+    EXPECT_TRUE(q.is_empty());
+
+    q.reopen();
+    EXPECT_FALSE(q.is_finalized());
+    EXPECT_EQ(q.enqueue_bulk(items, 4), 4u);
+    EXPECT_EQ(q.dequeue(), 1u);
+}
+
+// ============================================================================
+// Concurrent Tests (2 test cases)
+// ============================================================================
+
+TEST(SCQ64_EdgeCases, EnqueueSpinsWhenQueueIsFullUntilADequeueFreesSpace) {
+    lscq::SCQ64<std::uint64_t> q(16);
+    // Without concurrent dequeuers every ring slot can be filled; values must stay below ⊥.
+    const std::uint64_t value_limit = q.scqsize() - 1;
+    for (std::uint64_t i = 0; i < q.scqsize(); ++i) {
+        ASSERT_TRUE(q.enqueue(i % value_limit));
+    }
+
+    std::atomic<bool> done{false};
+    std::thread producer([&] {
+        EXPECT_TRUE(q.enqueue(7));
+        done.store(true, std::memory_order_release);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(done.load(std::memory_order_acquire));
+
+    EXPECT_EQ(q.dequeue(), 0u);
+    producer.join();
+    EXPECT_TRUE(done.load());
+}
+
+TEST(SCQ64_Concurrent, ProducersConsumersNoLossNoDup) {
+    constexpr std::size_t kProducers = 4;
+    constexpr std::size_t kConsumers = 4;
+    constexpr std::size_t kPerProducer = 10000;
+    constexpr std::size_t kTotal = kProducers * kPerProducer;
+
+    lscq::SCQ64<std::uint64_t> q(1u << 16);
+    ASSERT_LT(kTotal, q.scqsize() - 1);
+
+    std::vector<std::atomic<std::uint32_t>> seen(kTotal);
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::thread> threads;
+    for (std::size_t p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&, p] {
+            for (std::size_t i = 0; i < kPerProducer; ++i) {
+                ASSERT_TRUE(q.enqueue(p * kPerProducer + i));
+            }
+        });
+    }
+    for (std::size_t c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&] {
+            while (consumed.load(std::memory_order_relaxed) < kTotal) {
+                const std::uint64_t v = q.dequeue();
+                if (v == lscq::SCQ64<std::uint64_t>::kEmpty) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                seen[v].fetch_add(1, std::memory_order_relaxed);
+                consumed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (std::size_t i = 0; i < kTotal; ++i) {
+        ASSERT_EQ(seen[i].load(), 1u) << "value " << i;
+    }
+}
+
+}  // namespace
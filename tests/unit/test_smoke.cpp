@@ -1,15 +1,36 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <lscq/cas2.hpp>
+#include <lscq/ebr.hpp>
 #include <lscq/lscq.hpp>
+#include <lscq/msqueue.hpp>
+#include <lscq/ncq.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scqp.hpp>
 
 static_assert(LSCQ_ENABLE_CAS2 == 0 || LSCQ_ENABLE_CAS2 == 1, "LSCQ_ENABLE_CAS2 must be 0/1");
 static_assert(LSCQ_ENABLE_SANITIZERS == 0 || LSCQ_ENABLE_SANITIZERS == 1,
               "LSCQ_ENABLE_SANITIZERS must be 0/1");
 static_assert(LSCQ_COMPILER_CLANG == 0 || LSCQ_COMPILER_CLANG == 1,
               "LSCQ_COMPILER_CLANG must be 0/1");
+static_assert(lscq::config::CACHE_LINE_SIZE == LSCQ_CACHE_LINE,
+              "config::CACHE_LINE_SIZE must follow LSCQ_CACHE_LINE");
 
 TEST(Smoke, HeaderIncludesAndMacrosAreCoherent) {
     EXPECT_EQ(lscq::kEnableCas2, LSCQ_ENABLE_CAS2 != 0);
     EXPECT_EQ(lscq::kEnableSanitizers, LSCQ_ENABLE_SANITIZERS != 0);
     EXPECT_EQ(lscq::kCompilerIsClang, LSCQ_COMPILER_CLANG != 0);
 }
+
+TEST(Smoke, PaddedTypesFollowConfiguredCacheLine) {
+    constexpr std::size_t kLine = lscq::config::CACHE_LINE_SIZE;
+    EXPECT_EQ(alignof(lscq::NCQ<std::uint64_t>), kLine);
+    EXPECT_EQ(alignof(lscq::SCQ<std::uint64_t>), kLine);
+    EXPECT_EQ(alignof(lscq::SCQP<std::uint64_t>), kLine);
+    EXPECT_EQ(alignof(lscq::LSCQ<std::uint64_t>), kLine);
+    EXPECT_EQ(alignof(lscq::MSQueue<std::uint64_t>), kLine);
+    EXPECT_EQ(alignof(lscq::EBRManager), kLine);
+    EXPECT_EQ(alignof(lscq::detail::Cas2FallbackStripeLock), kLine);
+    EXPECT_EQ(lscq::DefaultRemap::stride(sizeof(lscq::Entry)), kLine / sizeof(lscq::Entry));
+}
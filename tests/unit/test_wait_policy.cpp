@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <lscq/lscq.hpp>
+#include <lscq/ncq.hpp>
+#include <lscq/object_pool_map.hpp>
+#include <lscq/scq.hpp>
+#include <lscq/scqp.hpp>
+#include <lscq/wait_policy.hpp>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+// ============================================================================
+// Policy Behaviour Tests (3 test cases)
+// ============================================================================
+
+TEST(WaitPolicy, DefaultIsBackoff) {
+    static_assert(std::is_same_v<lscq::DefaultWaitPolicy, lscq::BackoffWait>);
+    static_assert(std::is_same_v<lscq::SCQ<std::uint64_t>,
+                                 lscq::SCQ<std::uint64_t, lscq::DefaultWaitPolicy>>);
+    static_assert(std::is_same_v<lscq::LSCQ<std::uint64_t>,
+                                 lscq::LSCQ<std::uint64_t, lscq::DefaultWaitPolicy>>);
+}
+
+TEST(WaitPolicy, SpinThenParkSleepsOnlyAfterSpinAndYieldBudget) {
+    using Policy = lscq::SpinThenParkWait;
+    Policy w;
+    for (std::uint32_t i = 0; i < Policy::kSpinRounds + Policy::kYieldRounds; ++i) {
+        w.wait();
+    }
+
+    constexpr int kParks = 4;
+    const auto park_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kParks; ++i) {
+        w.wait();
+    }
+    EXPECT_GE(std::chrono::steady_clock::now() - park_start, Policy::kParkTime * kParks);
+
+    // After reset the policy spins again instead of sleeping.
+    w.reset();
+    const auto reset_start = std::chrono::steady_clock::now();
+    w.wait();
+    EXPECT_LT(std::chrono::steady_clock::now() - reset_start, Policy::kParkTime);
+}
+
+TEST(WaitPolicy, BackoffResetRestartsFromOnePause) {
+    lscq::BackoffWait w;
+    for (int i = 0; i < 16; ++i) {
+        w.wait();  // Past kMaxSpins: yields from here on.
+    }
+    w.reset();
+    const auto start = std::chrono::steady_clock::now();
+    w.wait();
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+}
+
+// ============================================================================
+// Queues Under Each Policy (4 test cases x 3 policies)
+// ============================================================================
+
+template <class Policy>
+class WaitPolicyQueueTest : public ::testing::Test {};
+
+using Policies = ::testing::Types<lscq::BusySpinWait, lscq::BackoffWait, lscq::SpinThenParkWait>;
+TYPED_TEST_SUITE(WaitPolicyQueueTest, Policies);
+
+constexpr std::uint64_t kItems = 20000;
+
+template <class Enq, class Deq>
+void run_spsc(Enq&& enq, Deq&& deq) {
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < kItems; ++i) {
+            while (!enq(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::uint64_t expected = 0;
+    while (expected < kItems) {
+        std::uint64_t v = 0;
+        if (deq(v)) {
+            ASSERT_EQ(v, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
+
+TYPED_TEST(WaitPolicyQueueTest, NcqSpscPreservesFifo) {
+    lscq::NCQ<std::uint64_t, TypeParam> q(1u << 16);
+    run_spsc([&](std::uint64_t v) { return q.enqueue(v); },
+             [&](std::uint64_t& out) {
+                 out = q.dequeue();
+                 return out != lscq::NCQ<std::uint64_t, TypeParam>::kEmpty;
+             });
+}
+
+TYPED_TEST(WaitPolicyQueueTest, ScqSpscPreservesFifo) {
+    lscq::SCQ<std::uint64_t, TypeParam> q(1u << 16);
+    run_spsc([&](std::uint64_t v) { return q.enqueue(v); },
+             [&](std::uint64_t& out) {
+                 out = q.dequeue();
+                 return out != lscq::SCQ<std::uint64_t, TypeParam>::kEmpty;
+             });
+}
+
+TYPED_TEST(WaitPolicyQueueTest, ScqpAndLscqSpscPreserveFifo) {
+    std::vector<std::uint64_t> values(kItems);
+    for (std::uint64_t i = 0; i < kItems; ++i) {
+        values[i] = i;
+    }
+
+    lscq::SCQP<std::uint64_t, TypeParam> scqp(256);
+    run_spsc([&](std::uint64_t v) { return scqp.enqueue(&values[v]); },
+             [&](std::uint64_t& out) {
+                 std::uint64_t* p = scqp.dequeue();
+                 if (p != nullptr) {
+                     out = *p;
+                 }
+                 return p != nullptr;
+             });
+
+    lscq::LSCQ<std::uint64_t, TypeParam> lscq_q(64);
+    run_spsc([&](std::uint64_t v) { return lscq_q.enqueue(&values[v]); },
+             [&](std::uint64_t& out) {
+                 std::uint64_t* p = lscq_q.dequeue();
+                 if (p != nullptr) {
+                     out = *p;
+                 }
+                 return p != nullptr;
+             });
+}
+
+TYPED_TEST(WaitPolicyQueueTest, ObjectPoolMapClearWithConcurrentUsers) {
+    lscq::ObjectPoolMap<int, TypeParam> pool([] { return new int(0); });
+    std::atomic<bool> stop{false};
+    std::thread user([&] {
+        while (!stop.load(std::memory_order_acquire)) {
+            pool.Put(pool.Get());
+        }
+    });
+    for (int i = 0; i < 50; ++i) {
+        pool.Clear();
+    }
+    stop.store(true, std::memory_order_release);
+    user.join();
+    pool.Clear();
+    EXPECT_EQ(pool.Size(), 0u);
+}
+
+}  // namespace